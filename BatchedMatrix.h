@@ -0,0 +1,385 @@
+// =========================================================
+// BatchedMatrix.h — 批量小矩阵 (SoA 布局) (Layer 2)
+// ---------------------------------------------------------
+// 职责: 一次存放 count 个 N x N 矩阵，元素 (i, j) 的 count 个值连续存放:
+//       下标 (i * N + j) * count + k，第 k 个矩阵的 (i, j) 元素
+// 所有运算的最内层循环都沿批量下标 k，步长为 1、无分支，
+// 编译器可自动向量化 (一条 AVX 指令同时处理 4 个 double / 8 个 float 矩阵)
+// N <= 4: 行列式、逆、求解走 SmallKernels 的闭式公式 (Cramer / 伴随矩阵)
+// N >  4: 部分主元 LU，每个矩阵各自选主元，行交换用逐元素 select 完成以保持无分支
+// 对称 2x2 / 3x3 另有闭式特征分解 symmetricEigen() (应力/应变张量等)
+// 相比逐个构造 Matrix<T> + SolvingEquation：没有任何逐矩阵的堆分配
+// =========================================================
+#pragma once
+
+#include "matrix.h"
+#include "SmallKernels.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+
+template <typename T, size_t N>
+class BatchedVector {
+private:
+    size_t count = 0;
+    std::vector<T> data;  // 下标 i * count + k
+
+public:
+    BatchedVector() = default;
+    explicit BatchedVector(size_t batchSize) : count(batchSize), data(N * batchSize, T(0)) {}
+
+    size_t size() const noexcept { return count; }
+    static constexpr size_t dim() noexcept { return N; }
+
+    T& at(size_t k, size_t i) { return data[i * count + k]; }
+    const T& at(size_t k, size_t i) const { return data[i * count + k]; }
+
+    // 分量 i 的 count 个值 (连续)
+    T* lane(size_t i) noexcept { return data.data() + i * count; }
+    const T* lane(size_t i) const noexcept { return data.data() + i * count; }
+
+    Vector<T> get(size_t k) const {
+        if (k >= count) throw std::out_of_range("Batch index out of bounds");
+        std::vector<T> v(N);
+        for (size_t i = 0; i < N; i++) v[i] = at(k, i);
+        return Vector<T>(std::move(v));
+    }
+
+    void set(size_t k, const Vector<T>& v) {
+        if (k >= count) throw std::out_of_range("Batch index out of bounds");
+        if (v.size() != N) throw std::invalid_argument("Vector size mismatch");
+        for (size_t i = 0; i < N; i++) at(k, i) = v[i];
+    }
+};
+
+template <typename T, size_t N>
+class BatchedMatrix {
+    static_assert(N >= 1, "BatchedMatrix: dimension must be positive");
+
+private:
+    size_t count = 0;
+    std::vector<T> data;  // 下标 (i * N + j) * count + k
+
+    // 批量中任一矩阵奇异即抛出，与 Matrix<T>::getInverseMatrix 一致
+    // 判定是相对的：N <= 4 按行尺度缩放行列式 (SmallKernels::isSingular)，N > 4 由 LU 的主元大小决定
+    static void checkSingular(const std::vector<char>& singular) {
+        for (size_t k = 0; k < singular.size(); k++) {
+            if (singular[k])
+                throw std::invalid_argument("Matrix is singular (batch index " + std::to_string(k) + ")");
+        }
+    }
+
+    // 每个线程处理连续一段批量下标，再切成 tileSize 宽的小块，
+    // 使一块内 N x N 个元素行的工作集留在 L1/L2 中
+    static constexpr size_t tileSize = 256;
+
+    template <typename Body>
+    void forEachTile(Body&& body) const {
+        parallelFor(0, count, 16 * tileSize, [&](size_t lo, size_t hi) {
+            for (size_t t = lo; t < hi; t += tileSize) body(t, std::min(hi, t + tileSize));
+        });
+    }
+
+    // 闭式路径：对每个 k 调用 SmallKernels，a 是对 SoA 下标的内联访问
+    template <typename Body>
+    void forEachClosedForm(Body&& body) const {
+        const T* src = data.data();
+        const size_t cnt = count;
+        forEachTile([&](size_t lo, size_t hi) {
+            for (size_t k = lo; k < hi; k++) {
+                auto a = [src, cnt, k](size_t i, size_t j) -> T { return src[(i * N + j) * cnt + k]; };
+                body(k, a);
+            }
+        });
+    }
+
+    // N > 4：对批量下标 [lo, hi) 原地做部分主元 LU，同时对 rhs (每个矩阵 m 列) 做相同的行变换
+    // det[k] 写入 U 对角线乘积乘置换符号
+    // singular 非空时，某步主元 |u_cc| <= eps * max|a_ij| (该矩阵自身的元素尺度) 即记为奇异
+    static void eliminate(T* a, T* rhs, size_t m, size_t cnt, size_t lo, size_t hi, T* det,
+                          T eps = T(0), char* singular = nullptr) {
+        auto A = [&](size_t i, size_t j) { return a + (i * N + j) * cnt; };
+        auto B = [&](size_t i, size_t j) { return rhs + (i * m + j) * cnt; };
+        size_t piv[tileSize];
+        T best[tileSize], factor[tileSize], threshold[tileSize];
+        const size_t w = hi - lo;
+        for (size_t k = lo; k < hi; k++) det[k] = T(1);
+        if (singular) {
+            for (size_t k = 0; k < w; k++) threshold[k] = T(0);
+            for (size_t e = 0; e < N * N; e++) {
+                const T* x = a + e * cnt + lo;
+                for (size_t k = 0; k < w; k++) threshold[k] = std::max(threshold[k], ScalarTraits<T>::magnitude(x[k]));
+            }
+            for (size_t k = 0; k < w; k++) {
+                threshold[k] *= eps;
+                singular[lo + k] = 0;
+            }
+        }
+
+        for (size_t c = 0; c < N; c++) {
+            // 1. 每个矩阵各自找主元行
+            {
+                const T* col = A(c, c) + lo;
+                for (size_t k = 0; k < w; k++) {
+                    piv[k] = c;
+                    best[k] = ScalarTraits<T>::magnitude(col[k]);
+                }
+            }
+            for (size_t r = c + 1; r < N; r++) {
+                const T* col = A(r, c) + lo;
+                for (size_t k = 0; k < w; k++) {
+                    T v = ScalarTraits<T>::magnitude(col[k]);
+                    bool better = v > best[k];
+                    best[k] = better ? v : best[k];
+                    piv[k] = better ? r : piv[k];
+                }
+            }
+            if (singular) {
+                for (size_t k = 0; k < w; k++) singular[lo + k] |= best[k] <= threshold[k];
+            }
+            // 2. 按 select 交换第 c 行与主元行
+            for (size_t r = c + 1; r < N; r++) {
+                auto swapRow = [&](T* x, T* y) {
+                    x += lo;
+                    y += lo;
+                    for (size_t k = 0; k < w; k++) {
+                        bool s = piv[k] == r;
+                        T tx = x[k], ty = y[k];
+                        x[k] = s ? ty : tx;
+                        y[k] = s ? tx : ty;
+                    }
+                };
+                for (size_t j = c; j < N; j++) swapRow(A(c, j), A(r, j));
+                for (size_t j = 0; j < m; j++) swapRow(B(c, j), B(r, j));
+            }
+            {
+                const T* d = A(c, c) + lo;
+                T* dt = det + lo;
+                for (size_t k = 0; k < w; k++) dt[k] = (piv[k] == c ? dt[k] : -dt[k]) * d[k];
+            }
+            // 3. 消去第 c 列下方元素
+            for (size_t r = c + 1; r < N; r++) {
+                const T* d = A(c, c) + lo;
+                const T* lead = A(r, c) + lo;
+                // 零主元 (该列已全为 0，行列式已为 0) 不再消元，避免 0/0 = NaN 污染 det
+                for (size_t k = 0; k < w; k++) factor[k] = d[k] == T(0) ? T(0) : lead[k] / d[k];
+                for (size_t j = c + 1; j < N; j++) {
+                    const T* src = A(c, j) + lo;
+                    T* dst = A(r, j) + lo;
+                    for (size_t k = 0; k < w; k++) dst[k] -= factor[k] * src[k];
+                }
+                for (size_t j = 0; j < m; j++) {
+                    const T* src = B(c, j) + lo;
+                    T* dst = B(r, j) + lo;
+                    for (size_t k = 0; k < w; k++) dst[k] -= factor[k] * src[k];
+                }
+            }
+        }
+    }
+
+    // 上三角回代 (eliminate 之后)，rhs 原地变为解
+    static void backSubstitute(const T* a, T* rhs, size_t m, size_t cnt, size_t lo, size_t hi) {
+        auto A = [&](size_t i, size_t j) { return a + (i * N + j) * cnt; };
+        auto B = [&](size_t i, size_t j) { return rhs + (i * m + j) * cnt; };
+        for (size_t i = N; i-- > 0;) {
+            for (size_t j = 0; j < m; j++) {
+                T* x = B(i, j);
+                for (size_t l = i + 1; l < N; l++) {
+                    const T* u = A(i, l);
+                    const T* y = B(l, j);
+                    for (size_t k = lo; k < hi; k++) x[k] -= u[k] * y[k];
+                }
+                const T* d = A(i, i);
+                for (size_t k = lo; k < hi; k++) x[k] /= d[k];
+            }
+        }
+    }
+
+public:
+    // 对称矩阵批量特征分解：eigenvalues 每个矩阵升序，eigenvectors 第 c 列对应第 c 个特征值
+    struct SymmetricEigen {
+        BatchedVector<T, N> eigenvalues;
+        BatchedMatrix<T, N> eigenvectors;
+    };
+
+    BatchedMatrix() = default;
+    explicit BatchedMatrix(size_t batchSize) : count(batchSize), data(N * N * batchSize, T(0)) {}
+
+    size_t size() const noexcept { return count; }
+    static constexpr size_t dim() noexcept { return N; }
+
+    T& at(size_t k, size_t i, size_t j) { return data[(i * N + j) * count + k]; }
+    const T& at(size_t k, size_t i, size_t j) const { return data[(i * N + j) * count + k]; }
+
+    // 元素 (i, j) 的 count 个值 (连续)，供调用方自行写向量化循环
+    T* lane(size_t i, size_t j) noexcept { return data.data() + (i * N + j) * count; }
+    const T* lane(size_t i, size_t j) const noexcept { return data.data() + (i * N + j) * count; }
+
+    Matrix<T> get(size_t k) const {
+        if (k >= count) throw std::out_of_range("Batch index out of bounds");
+        Matrix<T> m(N, N);
+        for (size_t i = 0; i < N; i++)
+            for (size_t j = 0; j < N; j++) m.at(i, j) = at(k, i, j);
+        return m;
+    }
+
+    void set(size_t k, const Matrix<T>& m) {
+        if (k >= count) throw std::out_of_range("Batch index out of bounds");
+        if (m.getRows() != N || m.getCols() != N) throw std::invalid_argument("Matrix dimensions mismatch");
+        for (size_t i = 0; i < N; i++)
+            for (size_t j = 0; j < N; j++) at(k, i, j) = m.at(i, j);
+    }
+
+    // -------- 批量运算 --------
+    std::vector<T> determinant() const {
+        if constexpr (N <= SmallKernels<T>::maxDim) {
+            std::vector<T> det(count);
+            forEachClosedForm([&](size_t k, const auto& a) { det[k] = SmallKernels<T>::template determinant<N>(a); });
+            return det;
+        } else {
+            std::vector<T> a(data), det(count);
+            forEachTile([&](size_t lo, size_t hi) { eliminate(a.data(), nullptr, 0, count, lo, hi, det.data()); });
+            return det;
+        }
+    }
+
+    BatchedMatrix getInverseMatrix(T eps = ScalarTraits<T>::epsilon()) const {
+        BatchedMatrix inv(count);
+        if constexpr (N <= SmallKernels<T>::maxDim) {
+            std::vector<char> singular(count);
+            T* dst = inv.data.data();
+            const size_t cnt = count;
+            forEachClosedForm([&](size_t k, const auto& a) {
+                T adj[N][N];
+                auto out = [&adj](size_t i, size_t j) -> T& { return adj[i][j]; };
+                const T det = SmallKernels<T>::template adjugate<N>(a, out);
+                singular[k] = SmallKernels<T>::template isSingular<N>(det, a, eps);
+                const T r = T(1) / det;
+                for (size_t i = 0; i < N; i++)
+                    for (size_t j = 0; j < N; j++) dst[(i * N + j) * cnt + k] = adj[i][j] * r;
+            });
+            checkSingular(singular);
+        } else {
+            std::vector<T> a(data), det(count);
+            std::vector<char> singular(count);
+            for (size_t i = 0; i < N; i++) {
+                T* x = inv.lane(i, i);
+                for (size_t k = 0; k < count; k++) x[k] = T(1);
+            }
+            forEachTile([&](size_t lo, size_t hi) {
+                eliminate(a.data(), inv.data.data(), N, count, lo, hi, det.data(), eps, singular.data());
+                backSubstitute(a.data(), inv.data.data(), N, count, lo, hi);
+            });
+            checkSingular(singular);
+        }
+        return inv;
+    }
+
+    // 解 count 个方程组 A_k x_k = b_k
+    BatchedVector<T, N> solve(const BatchedVector<T, N>& b, T eps = ScalarTraits<T>::epsilon()) const {
+        if (b.size() != count) throw std::invalid_argument("Batch size mismatch");
+        BatchedVector<T, N> x(count);
+        if constexpr (N <= SmallKernels<T>::maxDim) {
+            // Cramer：x = adj(A) b / det，伴随矩阵只存在寄存器里
+            std::vector<char> singular(count);
+            forEachClosedForm([&](size_t k, const auto& a) {
+                T adj[N][N];
+                auto out = [&adj](size_t i, size_t j) -> T& { return adj[i][j]; };
+                const T det = SmallKernels<T>::template adjugate<N>(a, out);
+                singular[k] = SmallKernels<T>::template isSingular<N>(det, a, eps);
+                for (size_t i = 0; i < N; i++) {
+                    T s = T(0);
+                    for (size_t j = 0; j < N; j++) s += adj[i][j] * b.at(k, j);
+                    x.at(k, i) = s / det;
+                }
+            });
+            checkSingular(singular);
+        } else {
+            // BatchedVector 与 m = 1 的右端项布局相同 (下标 i * count + k)，直接原地求解
+            std::vector<T> a(data), det(count);
+            std::vector<char> singular(count);
+            x = b;
+            forEachTile([&](size_t lo, size_t hi) {
+                eliminate(a.data(), x.lane(0), 1, count, lo, hi, det.data(), eps, singular.data());
+                backSubstitute(a.data(), x.lane(0), 1, count, lo, hi);
+            });
+            checkSingular(singular);
+        }
+        return x;
+    }
+
+    // 对称 2x2 / 3x3 的闭式特征分解 (只读上三角)
+    // 闭式公式对整批无分支执行；3x3 中谱宽过小的矩阵记下来，最后逐个用 Jacobi 重算
+    SymmetricEigen symmetricEigen() const {
+        static_assert(N == 2 || N == 3, "symmetricEigen: closed form only for 2x2 and 3x3");
+        static_assert(std::is_floating_point_v<T>, "symmetricEigen requires a floating-point type");
+        SymmetricEigen result{BatchedVector<T, N>(count), BatchedMatrix<T, N>(count)};
+        std::vector<char> fallback(count, 0);
+        T* vals = result.eigenvalues.lane(0);
+        T* vecs = result.eigenvectors.data.data();
+        const size_t cnt = count;
+
+        forEachClosedForm([&](size_t k, const auto& a) {
+            T w[N], V[N][N];
+            if constexpr (N == 2) {
+                SmallKernels<T>::symmetricEigen2(a, w, V);
+            } else {
+                fallback[k] = !SmallKernels<T>::symmetricEigen3(a, w, V);
+            }
+            for (size_t i = 0; i < N; i++) {
+                vals[i * cnt + k] = w[i];
+                for (size_t j = 0; j < N; j++) vecs[(i * N + j) * cnt + k] = V[i][j];
+            }
+        });
+
+        for (size_t k = 0; k < count; k++) {
+            if (!fallback[k]) continue;
+            T a[N][N], w[N], V[N][N];
+            for (size_t i = 0; i < N; i++)
+                for (size_t j = 0; j < N; j++) a[i][j] = at(k, std::min(i, j), std::max(i, j));
+            SmallKernels<T>::template jacobiEigen<N>(a, w, V);
+            for (size_t i = 0; i < N; i++) {
+                result.eigenvalues.at(k, i) = w[i];
+                for (size_t j = 0; j < N; j++) result.eigenvectors.at(k, i, j) = V[i][j];
+            }
+        }
+        return result;
+    }
+
+    BatchedMatrix operator*(const BatchedMatrix& other) const {
+        if (other.count != count) throw std::invalid_argument("Batch size mismatch");
+        BatchedMatrix result(count);
+        forEachTile([&](size_t lo, size_t hi) {
+            for (size_t i = 0; i < N; i++) {
+                for (size_t l = 0; l < N; l++) {
+                    const T* a = lane(i, l);
+                    for (size_t j = 0; j < N; j++) {
+                        const T* b = other.lane(l, j);
+                        T* c = result.lane(i, j);
+                        for (size_t k = lo; k < hi; k++) c[k] += a[k] * b[k];
+                    }
+                }
+            }
+        });
+        return result;
+    }
+
+    BatchedVector<T, N> operator*(const BatchedVector<T, N>& v) const {
+        if (v.size() != count) throw std::invalid_argument("Batch size mismatch");
+        BatchedVector<T, N> result(count);
+        forEachTile([&](size_t lo, size_t hi) {
+            for (size_t i = 0; i < N; i++) {
+                T* c = result.lane(i);
+                for (size_t j = 0; j < N; j++) {
+                    const T* a = lane(i, j);
+                    const T* b = v.lane(j);
+                    for (size_t k = lo; k < hi; k++) c[k] += a[k] * b[k];
+                }
+            }
+        });
+        return result;
+    }
+};
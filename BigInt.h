@@ -0,0 +1,427 @@
+// =========================================================
+// BigInt.h — 任意精度整数 (Layer 0)
+// ---------------------------------------------------------
+// 职责: 精确整数运算，供 Rational / 整数矩阵的精确行列式使用
+// 表示: 值落在 int64 范围内时直接存 long long (快速路径)；
+//       运算溢出时自动提升为 "符号 + 2^32 进制小端幅值"，结果变小后再降回 int64
+// 除法与取模与内置整数一致：商向零截断，余数与被除数同号
+// =========================================================
+#pragma once
+
+#include "ScalarTraits.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <climits>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+class BigInt {
+private:
+    using Mag = std::vector<uint32_t>;
+
+    bool isBig = false;     // false: 值存于 small；true: 值为 (negative ? -1 : 1) * mag
+    long long small = 0;
+    bool negative = false;
+    Mag mag;                // 小端，无前导 0，且一定超出 int64 范围
+
+    // -------- 幅值 (无符号) 运算 --------
+    static void trim(Mag& a) {
+        while (!a.empty() && a.back() == 0) a.pop_back();
+    }
+
+    static Mag magFromU64(uint64_t u) {
+        Mag m;
+        while (u) {
+            m.push_back(static_cast<uint32_t>(u));
+            u >>= 32;
+        }
+        return m;
+    }
+
+    static int cmpMag(const Mag& a, const Mag& b) {
+        if (a.size() != b.size()) return a.size() < b.size() ? -1 : 1;
+        for (size_t i = a.size(); i-- > 0; ) {
+            if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+        }
+        return 0;
+    }
+
+    static Mag addMag(const Mag& a, const Mag& b) {
+        const Mag& x = a.size() >= b.size() ? a : b;
+        const Mag& y = a.size() >= b.size() ? b : a;
+        Mag r(x.size() + 1);
+        uint64_t carry = 0;
+        for (size_t i = 0; i < x.size(); i++) {
+            uint64_t s = static_cast<uint64_t>(x[i]) + (i < y.size() ? y[i] : 0u) + carry;
+            r[i] = static_cast<uint32_t>(s);
+            carry = s >> 32;
+        }
+        r[x.size()] = static_cast<uint32_t>(carry);
+        trim(r);
+        return r;
+    }
+
+    // 要求 a >= b
+    static Mag subMag(const Mag& a, const Mag& b) {
+        Mag r(a.size());
+        int64_t borrow = 0;
+        for (size_t i = 0; i < a.size(); i++) {
+            int64_t d = static_cast<int64_t>(a[i]) - (i < b.size() ? b[i] : 0u) - borrow;
+            borrow = d < 0 ? 1 : 0;
+            r[i] = static_cast<uint32_t>(d + (borrow << 32));
+        }
+        trim(r);
+        return r;
+    }
+
+    static Mag mulMag(const Mag& a, const Mag& b) {
+        if (a.empty() || b.empty()) return Mag();
+        Mag r(a.size() + b.size(), 0);
+        for (size_t i = 0; i < a.size(); i++) {
+            uint64_t carry = 0;
+            uint64_t ai = a[i];
+            for (size_t j = 0; j < b.size(); j++) {
+                uint64_t cur = ai * b[j] + r[i + j] + carry;
+                r[i + j] = static_cast<uint32_t>(cur);
+                carry = cur >> 32;
+            }
+            size_t k = i + b.size();
+            while (carry) {
+                uint64_t cur = static_cast<uint64_t>(r[k]) + carry;
+                r[k++] = static_cast<uint32_t>(cur);
+                carry = cur >> 32;
+            }
+        }
+        trim(r);
+        return r;
+    }
+
+    static Mag divSmallMag(const Mag& a, uint32_t d, uint32_t& rem) {
+        Mag q(a.size());
+        uint64_t r = 0;
+        for (size_t i = a.size(); i-- > 0; ) {
+            uint64_t cur = (r << 32) | a[i];
+            q[i] = static_cast<uint32_t>(cur / d);
+            r = cur % d;
+        }
+        rem = static_cast<uint32_t>(r);
+        trim(q);
+        return q;
+    }
+
+    // Knuth Algorithm D (Hacker's Delight divmnu)，要求 v 非空
+    static void divModMag(const Mag& u, const Mag& v, Mag& q, Mag& r) {
+        if (cmpMag(u, v) < 0) {
+            q.clear();
+            r = u;
+            return;
+        }
+        if (v.size() == 1) {
+            uint32_t rem = 0;
+            q = divSmallMag(u, v[0], rem);
+            r = magFromU64(rem);
+            return;
+        }
+
+        const size_t n = v.size();
+        const size_t m = u.size() - n;
+        const int s = __builtin_clz(v.back());
+        Mag vn(n), un(u.size() + 1);
+        for (size_t i = n - 1; i > 0; i--)
+            vn[i] = (v[i] << s) | static_cast<uint32_t>(static_cast<uint64_t>(v[i - 1]) >> (32 - s));
+        vn[0] = v[0] << s;
+        un[u.size()] = static_cast<uint32_t>(static_cast<uint64_t>(u.back()) >> (32 - s));
+        for (size_t i = u.size() - 1; i > 0; i--)
+            un[i] = (u[i] << s) | static_cast<uint32_t>(static_cast<uint64_t>(u[i - 1]) >> (32 - s));
+        un[0] = u[0] << s;
+
+        const uint64_t base = 1ULL << 32;
+        q.assign(m + 1, 0);
+        for (size_t j = m + 1; j-- > 0; ) {
+            uint64_t num = (static_cast<uint64_t>(un[j + n]) << 32) | un[j + n - 1];
+            uint64_t qhat = num / vn[n - 1];
+            uint64_t rhat = num % vn[n - 1];
+            while (qhat >= base || qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2])) {
+                qhat--;
+                rhat += vn[n - 1];
+                if (rhat >= base) break;
+            }
+
+            int64_t k = 0, t = 0;
+            for (size_t i = 0; i < n; i++) {
+                uint64_t p = qhat * vn[i];
+                t = static_cast<int64_t>(un[i + j]) - k - static_cast<int64_t>(p & 0xFFFFFFFFULL);
+                un[i + j] = static_cast<uint32_t>(t);
+                k = static_cast<int64_t>(p >> 32) - (t >> 32);
+            }
+            t = static_cast<int64_t>(un[j + n]) - k;
+            un[j + n] = static_cast<uint32_t>(t);
+
+            q[j] = static_cast<uint32_t>(qhat);
+            if (t < 0) {
+                q[j]--;
+                uint64_t c = 0;
+                for (size_t i = 0; i < n; i++) {
+                    uint64_t sum = static_cast<uint64_t>(un[i + j]) + vn[i] + c;
+                    un[i + j] = static_cast<uint32_t>(sum);
+                    c = sum >> 32;
+                }
+                un[j + n] = static_cast<uint32_t>(un[j + n] + c);
+            }
+        }
+        trim(q);
+
+        r.assign(n, 0);
+        for (size_t i = 0; i < n; i++)
+            r[i] = (un[i] >> s) | static_cast<uint32_t>(static_cast<uint64_t>(un[i + 1]) << (32 - s));
+        trim(r);
+    }
+
+    // -------- 表示转换 --------
+    void toMag(bool& neg, Mag& m) const {
+        if (isBig) {
+            neg = negative;
+            m = mag;
+            return;
+        }
+        neg = small < 0;
+        uint64_t u = neg ? 0ULL - static_cast<uint64_t>(small) : static_cast<uint64_t>(small);
+        m = magFromU64(u);
+    }
+
+    // 由符号 + 幅值构造，能放进 int64 时降回快速路径
+    static BigInt fromMag(bool neg, Mag m) {
+        trim(m);
+        BigInt r;
+        if (m.size() <= 2) {
+            uint64_t u = m.empty() ? 0 : m[0];
+            if (m.size() == 2) u |= static_cast<uint64_t>(m[1]) << 32;
+            if (!neg && u <= static_cast<uint64_t>(LLONG_MAX)) {
+                r.small = static_cast<long long>(u);
+                return r;
+            }
+            if (neg && u <= static_cast<uint64_t>(LLONG_MAX) + 1) {
+                r.small = static_cast<long long>(0ULL - u);
+                return r;
+            }
+        }
+        r.isBig = true;
+        r.negative = neg;
+        r.mag = std::move(m);
+        return r;
+    }
+
+    static BigInt addSigned(bool an, const Mag& am, bool bn, const Mag& bm) {
+        if (an == bn) return fromMag(an, addMag(am, bm));
+        int c = cmpMag(am, bm);
+        if (c == 0) return BigInt();
+        return c > 0 ? fromMag(an, subMag(am, bm)) : fromMag(bn, subMag(bm, am));
+    }
+
+public:
+    BigInt() = default;
+
+    template <typename I, typename = std::enable_if_t<std::is_integral_v<I>>>
+    BigInt(I v) {
+        if constexpr (std::is_signed_v<I>) {
+            small = static_cast<long long>(v);
+        } else if (static_cast<unsigned long long>(v) <= static_cast<unsigned long long>(LLONG_MAX)) {
+            small = static_cast<long long>(v);
+        } else {
+            isBig = true;
+            mag = magFromU64(static_cast<uint64_t>(v));
+        }
+    }
+
+    explicit BigInt(const std::string& s) {
+        size_t pos = 0;
+        bool neg = false;
+        if (pos < s.size() && (s[pos] == '-' || s[pos] == '+')) neg = (s[pos++] == '-');
+        if (pos == s.size()) throw std::invalid_argument("BigInt: empty digit string");
+        BigInt result;
+        for (; pos < s.size(); pos++) {
+            if (s[pos] < '0' || s[pos] > '9') throw std::invalid_argument("BigInt: invalid digit");
+            result = result * 10 + (s[pos] - '0');
+        }
+        *this = neg ? -result : result;
+    }
+
+    bool fitsInt64() const noexcept { return !isBig; }
+    long long toInt64() const {
+        if (isBig) throw std::overflow_error("BigInt does not fit in int64");
+        return small;
+    }
+
+    int sign() const noexcept {
+        if (isBig) return negative ? -1 : 1;
+        return (small > 0) - (small < 0);
+    }
+
+    explicit operator long double() const {
+        if (!isBig) return static_cast<long double>(small);
+        long double r = 0;
+        for (size_t i = mag.size(); i-- > 0; ) r = r * 4294967296.0L + mag[i];
+        return negative ? -r : r;
+    }
+
+    explicit operator double() const { return static_cast<double>(static_cast<long double>(*this)); }
+
+    // -------- 算术 --------
+    BigInt operator-() const {
+        if (!isBig && small != LLONG_MIN) {
+            BigInt r;
+            r.small = -small;
+            return r;
+        }
+        bool neg;
+        Mag m;
+        toMag(neg, m);
+        return fromMag(!neg, std::move(m));
+    }
+
+    friend BigInt operator+(const BigInt& a, const BigInt& b) {
+        long long s;
+        if (!a.isBig && !b.isBig && !__builtin_add_overflow(a.small, b.small, &s)) {
+            BigInt r;
+            r.small = s;
+            return r;
+        }
+        bool an, bn;
+        Mag am, bm;
+        a.toMag(an, am);
+        b.toMag(bn, bm);
+        return addSigned(an, am, bn, bm);
+    }
+
+    friend BigInt operator-(const BigInt& a, const BigInt& b) {
+        long long s;
+        if (!a.isBig && !b.isBig && !__builtin_sub_overflow(a.small, b.small, &s)) {
+            BigInt r;
+            r.small = s;
+            return r;
+        }
+        bool an, bn;
+        Mag am, bm;
+        a.toMag(an, am);
+        b.toMag(bn, bm);
+        return addSigned(an, am, !bn, bm);
+    }
+
+    friend BigInt operator*(const BigInt& a, const BigInt& b) {
+        long long p;
+        if (!a.isBig && !b.isBig && !__builtin_mul_overflow(a.small, b.small, &p)) {
+            BigInt r;
+            r.small = p;
+            return r;
+        }
+        bool an, bn;
+        Mag am, bm;
+        a.toMag(an, am);
+        b.toMag(bn, bm);
+        return fromMag(an != bn, mulMag(am, bm));
+    }
+
+    // 截断除法，同时给出商与余数
+    static void divMod(const BigInt& a, const BigInt& b, BigInt& q, BigInt& r) {
+        if (b.sign() == 0) throw std::domain_error("BigInt division by zero");
+        if (!a.isBig && !b.isBig && !(a.small == LLONG_MIN && b.small == -1)) {
+            q = BigInt(a.small / b.small);
+            r = BigInt(a.small % b.small);
+            return;
+        }
+        bool an, bn;
+        Mag am, bm, qm, rm;
+        a.toMag(an, am);
+        b.toMag(bn, bm);
+        divModMag(am, bm, qm, rm);
+        q = fromMag(an != bn, std::move(qm));
+        r = fromMag(an, std::move(rm));
+    }
+
+    friend BigInt operator/(const BigInt& a, const BigInt& b) {
+        BigInt q, r;
+        divMod(a, b, q, r);
+        return q;
+    }
+
+    friend BigInt operator%(const BigInt& a, const BigInt& b) {
+        BigInt q, r;
+        divMod(a, b, q, r);
+        return r;
+    }
+
+    BigInt& operator+=(const BigInt& o) { return *this = *this + o; }
+    BigInt& operator-=(const BigInt& o) { return *this = *this - o; }
+    BigInt& operator*=(const BigInt& o) { return *this = *this * o; }
+    BigInt& operator/=(const BigInt& o) { return *this = *this / o; }
+    BigInt& operator%=(const BigInt& o) { return *this = *this % o; }
+
+    // -------- 比较 --------
+    static int compare(const BigInt& a, const BigInt& b) {
+        if (!a.isBig && !b.isBig) return (a.small > b.small) - (a.small < b.small);
+        int sa = a.sign(), sb = b.sign();
+        if (sa != sb) return sa < sb ? -1 : 1;
+        bool an, bn;
+        Mag am, bm;
+        a.toMag(an, am);
+        b.toMag(bn, bm);
+        int c = cmpMag(am, bm);
+        return sa < 0 ? -c : c;
+    }
+
+    friend bool operator==(const BigInt& a, const BigInt& b) { return compare(a, b) == 0; }
+    friend bool operator!=(const BigInt& a, const BigInt& b) { return compare(a, b) != 0; }
+    friend bool operator<(const BigInt& a, const BigInt& b) { return compare(a, b) < 0; }
+    friend bool operator>(const BigInt& a, const BigInt& b) { return compare(a, b) > 0; }
+    friend bool operator<=(const BigInt& a, const BigInt& b) { return compare(a, b) <= 0; }
+    friend bool operator>=(const BigInt& a, const BigInt& b) { return compare(a, b) >= 0; }
+
+    // -------- 数论 --------
+    static BigInt abs(const BigInt& a) { return a.sign() < 0 ? -a : a; }
+
+    static BigInt gcd(BigInt a, BigInt b) {
+        a = abs(a);
+        b = abs(b);
+        while (b.sign() != 0) {
+            BigInt t = a % b;
+            a = std::move(b);
+            b = std::move(t);
+        }
+        return a;
+    }
+
+    std::string toString() const {
+        if (!isBig) return std::to_string(small);
+        std::string digits;
+        Mag m = mag;
+        while (!m.empty()) {
+            uint32_t rem = 0;
+            m = divSmallMag(m, 1000000000u, rem);
+            for (int i = 0; i < 9; i++) {
+                digits.push_back(static_cast<char>('0' + rem % 10));
+                rem /= 10;
+                if (m.empty() && rem == 0) break;
+            }
+        }
+        if (negative) digits.push_back('-');
+        std::reverse(digits.begin(), digits.end());
+        return digits;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const BigInt& a) {
+        return os << a.toString();
+    }
+};
+
+template <>
+struct ScalarTraits<BigInt> {
+    static constexpr bool isExact = true;
+    static constexpr bool isIntegral = true;
+    static BigInt epsilon() { return BigInt(0); }
+    static BigInt abs(const BigInt& x) { return BigInt::abs(x); }
+    static BigInt magnitude(const BigInt& x) { return BigInt::abs(x); }
+    static bool isZero(const BigInt& x, const BigInt&) { return x.sign() == 0; }
+};
@@ -0,0 +1,241 @@
+// =========================================================
+// BitMatrix.h — GF(2) 位压缩矩阵 (Layer 2)
+// ---------------------------------------------------------
+// 职责: 0/1 矩阵每 64 个元素压进一个 uint64_t，行加法就是按字 XOR
+//       BitRREF 用 Method of Four Russians (M4RI) 做消元，
+//       接口与 RREF<T> 对齐: toREF / toRREF / getRank / getPivotCols / getKernel
+// 相比 RREF<double>：内存省 64 倍，判零是精确的位测试，不需要 eps
+// =========================================================
+#pragma once
+
+#include "matrix.h"
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+
+class BitMatrix {
+private:
+    size_t rows = 0;
+    size_t cols = 0;
+    size_t words = 0;               // 每行的字数 ceil(cols / 64)
+    std::vector<uint64_t> bits;     // 行主序连续存储
+
+    friend class BitRREF;
+
+public:
+    BitMatrix() = default;
+
+    BitMatrix(size_t r, size_t c) : rows(r), cols(c), words((c + 63) / 64), bits(r * ((c + 63) / 64), 0) {
+        if (r == 0 || c == 0) throw std::invalid_argument("Matrix dimensions must be positive");
+    }
+
+    // 从普通矩阵构造：整数取奇偶，其余类型非零即 1
+    template <typename T>
+    explicit BitMatrix(const Matrix<T>& m) : BitMatrix(m.getRows(), m.getCols()) {
+        for (size_t i = 0; i < rows; i++) {
+            for (size_t j = 0; j < cols; j++) {
+                bool v;
+                if constexpr (ScalarTraits<T>::isIntegral) v = !(m.at(i, j) % T(2) == T(0));
+                else v = !(m.at(i, j) == T(0));
+                if (v) set(i, j, true);
+            }
+        }
+    }
+
+    size_t getRows() const noexcept { return rows; }
+    size_t getCols() const noexcept { return cols; }
+
+    bool get(size_t r, size_t c) const {
+        if (r >= rows || c >= cols) throw std::out_of_range("Matrix index out of bounds");
+        return (row(r)[c >> 6] >> (c & 63)) & 1u;
+    }
+
+    void set(size_t r, size_t c, bool v) {
+        if (r >= rows || c >= cols) throw std::out_of_range("Matrix index out of bounds");
+        uint64_t mask = uint64_t(1) << (c & 63);
+        if (v) row(r)[c >> 6] |= mask;
+        else row(r)[c >> 6] &= ~mask;
+    }
+
+    uint64_t* row(size_t r) noexcept { return bits.data() + r * words; }
+    const uint64_t* row(size_t r) const noexcept { return bits.data() + r * words; }
+    size_t wordsPerRow() const noexcept { return words; }
+
+    // -------- Row Operations --------
+    void exchangeRows(size_t r1, size_t r2) {
+        if (r1 >= rows || r2 >= rows) throw std::out_of_range("Row index out of bounds");
+        if (r1 == r2) return;
+        std::swap_ranges(row(r1), row(r1) + words, row(r2));
+    }
+
+    // GF(2) 上的 addScaledRow：target ^= source (从第 fromWord 个字开始)
+    void xorRow(size_t target, size_t source, size_t fromWord = 0) {
+        if (target >= rows || source >= rows) throw std::out_of_range("Row index out of bounds");
+        uint64_t* t = row(target);
+        const uint64_t* s = row(source);
+        for (size_t w = fromWord; w < words; w++) t[w] ^= s[w];
+    }
+
+    template <typename T>
+    Matrix<T> toMatrix() const {
+        Matrix<T> m(rows, cols);
+        for (size_t i = 0; i < rows; i++)
+            for (size_t j = 0; j < cols; j++)
+                if (get(i, j)) m.at(i, j) = T(1);
+        return m;
+    }
+
+    void display() const {
+        std::cout << "\033[36m" << "BitMatrix (" << rows << "x" << cols << "):" << "\033[0m" << std::endl;
+        for (size_t i = 0; i < rows; i++) {
+            std::cout << "  ";
+            for (size_t j = 0; j < cols; j++) std::cout << (get(i, j) ? '1' : '0');
+            std::cout << std::endl;
+        }
+    }
+};
+
+class BitRREF {
+private:
+    BitMatrix mat;
+    size_t rank = 0;
+    std::vector<size_t> pivotCols;
+    std::vector<size_t> pivotRows;
+    bool isREF = false;
+    bool isRREF = false;
+
+    // 每块最多处理的主元列数 (查表大小 2^k 行)
+    static constexpr size_t blockWidth = 8;
+
+    bool bit(const uint64_t* r, size_t c) const noexcept { return (r[c >> 6] >> (c & 63)) & 1u; }
+
+    // M4RI：每次处理 blockWidth 列
+    // 1. 在当前块内找主元：逐行扫描，扫描到的行先用本块已有主元行约化 (惰性约化)
+    // 2. 块内主元行两两互相消去，使其在本块主元列上构成单位阵
+    // 3. 按 Gray 码用 2^kk 次行 XOR 建出主元行所有组合的表
+    // 4. 其余每行读出 kk 个主元列的位作为下标，查表一次 XOR 完成整块消元
+    // reduced = false 时只处理主元行以下的行 (阶梯形)，true 时连同上方行 (最简形)
+    void eliminate(bool reduced) {
+        const size_t rows = mat.rows;
+        const size_t cols = mat.cols;
+        const size_t words = mat.words;
+        rank = 0;
+        pivotCols.clear();
+        pivotRows.clear();
+
+        std::vector<uint64_t> table;
+        size_t r = 0;
+        for (size_t c = 0; c < cols && r < rows; c += blockWidth) {
+            const size_t blockEnd = std::min(cols, c + blockWidth);
+            const size_t fromWord = c >> 6;
+            std::vector<size_t> blockPivots;
+
+            for (size_t j = c; j < blockEnd && r + blockPivots.size() < rows; j++) {
+                size_t found = rows;
+                for (size_t i = r + blockPivots.size(); i < rows; i++) {
+                    uint64_t* ri = mat.row(i);
+                    for (size_t k = 0; k < blockPivots.size(); k++) {
+                        if (bit(ri, blockPivots[k])) mat.xorRow(i, r + k, fromWord);
+                    }
+                    if (bit(ri, j)) {
+                        found = i;
+                        break;
+                    }
+                }
+                if (found == rows) continue;
+                mat.exchangeRows(found, r + blockPivots.size());
+                blockPivots.push_back(j);
+            }
+
+            const size_t kk = blockPivots.size();
+            if (kk == 0) continue;
+
+            // 块内主元行互相消去 (含向上)，使主元列上为单位阵
+            for (size_t a = 0; a < kk; a++) {
+                for (size_t b = 0; b < kk; b++) {
+                    if (a != b && bit(mat.row(r + b), blockPivots[a])) mat.xorRow(r + b, r + a, fromWord);
+                }
+            }
+
+            // Gray 码建表：table[x] = 主元行按 x 的各位组合后的 XOR
+            const size_t span = words - fromWord;
+            table.assign((size_t(1) << kk) * span, 0);
+            for (size_t x = 1; x < (size_t(1) << kk); x++) {
+                size_t low = static_cast<size_t>(__builtin_ctzll(x));
+                const uint64_t* prev = table.data() + (x & (x - 1)) * span;
+                const uint64_t* src = mat.row(r + low) + fromWord;
+                uint64_t* dst = table.data() + x * span;
+                for (size_t w = 0; w < span; w++) dst[w] = prev[w] ^ src[w];
+            }
+
+            const size_t startRow = reduced ? 0 : r + kk;
+            for (size_t i = startRow; i < rows; i++) {
+                if (i >= r && i < r + kk) continue;
+                uint64_t* ri = mat.row(i);
+                size_t idx = 0;
+                for (size_t k = 0; k < kk; k++) idx |= static_cast<size_t>(bit(ri, blockPivots[k])) << k;
+                if (idx == 0) continue;
+                const uint64_t* t = table.data() + idx * span;
+                for (size_t w = 0; w < span; w++) ri[fromWord + w] ^= t[w];
+            }
+
+            for (size_t k = 0; k < kk; k++) {
+                pivotCols.push_back(blockPivots[k]);
+                pivotRows.push_back(r + k);
+            }
+            rank += kk;
+            r += kk;
+        }
+    }
+
+public:
+    explicit BitRREF(const BitMatrix& inputMat) : mat(inputMat) {}
+
+    void toREF() {
+        eliminate(false);
+        isREF = true;
+        isRREF = false;
+    }
+
+    void toRREF() {
+        eliminate(true);
+        isREF = true;
+        isRREF = true;
+    }
+
+    size_t getRank() const noexcept { return rank; }
+    const BitMatrix& getMatrix() const noexcept { return mat; }
+    const std::vector<size_t>& getPivotCols() const noexcept { return pivotCols; }
+    const std::vector<size_t>& getPivotRows() const noexcept { return pivotRows; }
+
+    // 零空间的基：与 RREF<T>::getKernel 相同的构造 (自由列置 1，主元列取 RREF 对应元素，GF(2) 中 -x = x)
+    // 返回矩阵的第 t 行是第 t 个基向量，保持位压缩存储
+    BitMatrix getKernel() {
+        if (!isRREF) toRREF();
+        const size_t n = mat.cols;
+        std::vector<bool> isPivot(n, false);
+        for (size_t pc : pivotCols) isPivot[pc] = true;
+        std::vector<size_t> freeCols;
+        for (size_t j = 0; j < n; j++) {
+            if (!isPivot[j]) freeCols.push_back(j);
+        }
+        if (freeCols.empty()) return BitMatrix();
+
+        BitMatrix basis(freeCols.size(), n);
+        for (size_t t = 0; t < freeCols.size(); t++) {
+            const size_t freeCol = freeCols[t];
+            uint64_t* v = basis.row(t);
+            v[freeCol >> 6] |= uint64_t(1) << (freeCol & 63);
+            for (size_t i = 0; i < rank; i++) {
+                if (bit(mat.row(pivotRows[i]), freeCol)) {
+                    size_t pc = pivotCols[i];
+                    v[pc >> 6] |= uint64_t(1) << (pc & 63);
+                }
+            }
+        }
+        return basis;
+    }
+};
@@ -0,0 +1,235 @@
+// =========================================================
+// DoubleDouble.h — double-double 扩展精度标量 (Layer 0)
+// ---------------------------------------------------------
+// 职责: 用两个 double 的未求值和 hi + lo (|lo| <= ulp(hi)/2) 表示约 106 位尾数，
+//       可直接代入 Matrix<T> / RREF<T> / SolvingEquation<T> / VectorSet<T>
+// 实现: 无误差变换 twoSum / twoProd (fma)，全部是硬件 double 运算，
+//       代价约为 double 的 10 倍，远低于软件任意精度
+// 适用: Hilbert 类病态矩阵 (条件数到 1e28 左右) 的求逆、求解与特征值
+// =========================================================
+#pragma once
+
+#include "ScalarTraits.h"
+#include <cmath>
+#include <limits>
+#include <string>
+#include <iostream>
+#include <type_traits>
+
+class DoubleDouble {
+private:
+    double hi_ = 0.0;
+    double lo_ = 0.0;
+
+    // -------- 无误差变换 --------
+    // a + b = s + err (精确)
+    static void twoSum(double a, double b, double& s, double& err) {
+        s = a + b;
+        double bb = s - a;
+        err = (a - (s - bb)) + (b - bb);
+    }
+
+    // 要求 |a| >= |b|
+    static void quickTwoSum(double a, double b, double& s, double& err) {
+        s = a + b;
+        err = b - (s - a);
+    }
+
+    // a * b = p + err (精确，依赖 fma)
+    static void twoProd(double a, double b, double& p, double& err) {
+        p = a * b;
+        err = std::fma(a, b, -p);
+    }
+
+    static DoubleDouble renormalize(double a, double b) {
+        DoubleDouble r;
+        quickTwoSum(a, b, r.hi_, r.lo_);
+        return r;
+    }
+
+public:
+    DoubleDouble() = default;
+    DoubleDouble(double x) : hi_(x), lo_(0.0) {}
+    DoubleDouble(double h, double l) { quickTwoSum(h, l, hi_, lo_); }
+
+    // 64 位整数超出 double 尾数的部分放进 lo，保证精确
+    template <typename I, typename = std::enable_if_t<std::is_integral_v<I>>>
+    DoubleDouble(I x) {
+        double h = static_cast<double>(x);
+        double l = static_cast<double>(static_cast<long double>(x) - static_cast<long double>(h));
+        quickTwoSum(h, l, hi_, lo_);
+    }
+
+    double hi() const noexcept { return hi_; }
+    double lo() const noexcept { return lo_; }
+
+    explicit operator double() const { return hi_ + lo_; }
+    explicit operator long double() const { return static_cast<long double>(hi_) + lo_; }
+    explicit operator float() const { return static_cast<float>(hi_); }
+
+    // -------- 算术 --------
+    DoubleDouble operator-() const {
+        DoubleDouble r;
+        r.hi_ = -hi_;
+        r.lo_ = -lo_;
+        return r;
+    }
+
+    friend DoubleDouble operator+(const DoubleDouble& a, const DoubleDouble& b) {
+        double s1, s2, t1, t2;
+        twoSum(a.hi_, b.hi_, s1, s2);
+        twoSum(a.lo_, b.lo_, t1, t2);
+        s2 += t1;
+        quickTwoSum(s1, s2, s1, s2);
+        s2 += t2;
+        return renormalize(s1, s2);
+    }
+
+    friend DoubleDouble operator-(const DoubleDouble& a, const DoubleDouble& b) { return a + (-b); }
+
+    friend DoubleDouble operator*(const DoubleDouble& a, const DoubleDouble& b) {
+        double p1, p2;
+        twoProd(a.hi_, b.hi_, p1, p2);
+        p2 += a.hi_ * b.lo_ + a.lo_ * b.hi_;
+        return renormalize(p1, p2);
+    }
+
+    // 长除法：三次 double 商逐步修正余数
+    friend DoubleDouble operator/(const DoubleDouble& a, const DoubleDouble& b) {
+        double q1 = a.hi_ / b.hi_;
+        DoubleDouble r = a - b * DoubleDouble(q1);
+        double q2 = r.hi_ / b.hi_;
+        r = r - b * DoubleDouble(q2);
+        double q3 = r.hi_ / b.hi_;
+        return renormalize(q1, q2) + DoubleDouble(q3);
+    }
+
+    DoubleDouble& operator+=(const DoubleDouble& o) { return *this = *this + o; }
+    DoubleDouble& operator-=(const DoubleDouble& o) { return *this = *this - o; }
+    DoubleDouble& operator*=(const DoubleDouble& o) { return *this = *this * o; }
+    DoubleDouble& operator/=(const DoubleDouble& o) { return *this = *this / o; }
+
+    // -------- 比较 (hi 相同时比较 lo) --------
+    friend bool operator==(const DoubleDouble& a, const DoubleDouble& b) { return a.hi_ == b.hi_ && a.lo_ == b.lo_; }
+    friend bool operator!=(const DoubleDouble& a, const DoubleDouble& b) { return !(a == b); }
+    friend bool operator<(const DoubleDouble& a, const DoubleDouble& b) {
+        return a.hi_ < b.hi_ || (a.hi_ == b.hi_ && a.lo_ < b.lo_);
+    }
+    friend bool operator>(const DoubleDouble& a, const DoubleDouble& b) { return b < a; }
+    friend bool operator<=(const DoubleDouble& a, const DoubleDouble& b) { return !(b < a); }
+    friend bool operator>=(const DoubleDouble& a, const DoubleDouble& b) { return !(a < b); }
+
+    // -------- 初等函数 --------
+    friend DoubleDouble abs(const DoubleDouble& x) { return x.hi_ < 0 ? -x : x; }
+
+    // 一步 Newton：y + (x - y^2) / (2y)，y 取 double 平方根
+    friend DoubleDouble sqrt(const DoubleDouble& x) {
+        if (x.hi_ <= 0) return x.hi_ == 0 ? DoubleDouble() : DoubleDouble(std::numeric_limits<double>::quiet_NaN());
+        double y = std::sqrt(x.hi_);
+        double p, e;
+        twoProd(y, y, p, e);
+        DoubleDouble r = x - DoubleDouble(p, e);
+        return DoubleDouble(y) + DoubleDouble(r.hi_ / (2.0 * y));
+    }
+
+    // exp(x) = 2^k * exp(r)^512，r = (x - k ln2) / 512
+    // Taylor 级数求 s = exp(r) - 1，平方还原时用 (1 + s)^2 - 1 = s (s + 2)，避免 1 + s 吞掉 s 的低位
+    friend DoubleDouble exp(const DoubleDouble& x) {
+        if (x.hi_ > 709.0) return DoubleDouble(std::numeric_limits<double>::infinity());
+        if (x.hi_ < -745.0) return DoubleDouble();
+        const DoubleDouble ln2(6.931471805599452862e-01, 2.319046813846299558e-17);
+        double k = std::floor(x.hi_ / ln2.hi_ + 0.5);
+        DoubleDouble r = (x - ln2 * DoubleDouble(k)) / DoubleDouble(512.0);
+
+        DoubleDouble s = r, term = r;
+        for (int i = 2; i <= 20; i++) {
+            term = term * r / DoubleDouble(static_cast<double>(i));
+            s += term;
+            if (std::abs(term.hi_) < 1e-35) break;
+        }
+        for (int i = 0; i < 9; i++) s = s * (s + DoubleDouble(2.0));
+        s += DoubleDouble(1.0);
+        return renormalize(std::ldexp(s.hi_, static_cast<int>(k)), std::ldexp(s.lo_, static_cast<int>(k)));
+    }
+
+    // 一步 Newton：y + x * exp(-y) - 1，y 取 double 对数
+    friend DoubleDouble log(const DoubleDouble& x) {
+        if (x.hi_ <= 0) {
+            return DoubleDouble(x.hi_ == 0 ? -std::numeric_limits<double>::infinity()
+                                           : std::numeric_limits<double>::quiet_NaN());
+        }
+        DoubleDouble y(std::log(x.hi_));
+        return y + x * exp(-y) - DoubleDouble(1.0);
+    }
+
+    // 科学计数法输出 digits 位有效数字 (double-double 约 31 位)
+    std::string toString(int digits = 32) const {
+        if (std::isnan(hi_)) return "nan";
+        if (std::isinf(hi_)) return hi_ > 0 ? "inf" : "-inf";
+        if (hi_ == 0) return "0";
+
+        std::string s = hi_ < 0 ? "-" : "";
+        DoubleDouble x = abs(*this);
+        int e = static_cast<int>(std::floor(std::log10(x.hi_)));
+        DoubleDouble p(1.0);
+        for (int i = 0; i < std::abs(e); i++) p *= DoubleDouble(10.0);
+        x = e >= 0 ? x / p : x * p;
+        if (x.hi_ >= 10.0) { x /= DoubleDouble(10.0); e++; }
+        if (x.hi_ < 1.0) { x *= DoubleDouble(10.0); e--; }
+
+        for (int i = 0; i < digits; i++) {
+            int d = static_cast<int>(std::floor(x.hi_));
+            if (d < 0) d = 0;
+            if (d > 9) d = 9;
+            s += static_cast<char>('0' + d);
+            if (i == 0 && digits > 1) s += '.';
+            x = (x - DoubleDouble(static_cast<double>(d))) * DoubleDouble(10.0);
+        }
+        return s + "e" + std::to_string(e);
+    }
+
+    // 流输出走 long double，保持 std::setw / std::setprecision 等格式控制；完整精度用 toString()
+    friend std::ostream& operator<<(std::ostream& os, const DoubleDouble& x) {
+        return os << static_cast<long double>(x);
+    }
+};
+
+// 友元在命名空间作用域再声明一次，使 ::sqrt / ::log 等限定调用也能找到
+DoubleDouble abs(const DoubleDouble& x);
+DoubleDouble sqrt(const DoubleDouble& x);
+DoubleDouble exp(const DoubleDouble& x);
+DoubleDouble log(const DoubleDouble& x);
+
+namespace std {
+template <>
+class numeric_limits<DoubleDouble> {
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 106;
+    static constexpr int digits10 = 31;
+    static DoubleDouble epsilon() { return DoubleDouble(4.93038065763132e-32); }  // 2^-104
+    static DoubleDouble min() { return DoubleDouble(numeric_limits<double>::min()); }
+    static DoubleDouble max() { return DoubleDouble(numeric_limits<double>::max()); }
+    static DoubleDouble lowest() { return -max(); }
+    static DoubleDouble infinity() { return DoubleDouble(numeric_limits<double>::infinity()); }
+    static DoubleDouble quiet_NaN() { return DoubleDouble(numeric_limits<double>::quiet_NaN()); }
+};
+}  // namespace std
+
+template <>
+struct ScalarTraits<DoubleDouble> {
+    using D = DoubleDouble;
+    static constexpr bool isExact = false;
+    static constexpr bool isIntegral = false;
+    // 单位舍入约 5e-32，留出 4 位余量给消元累积误差；再大会把 Hilbert 类矩阵的真实小主元判成 0
+    static D epsilon() { return D(1e-28); }
+    static D abs(const D& x) { return ::abs(x); }
+    static D magnitude(const D& x) { return ::abs(x); }
+    static bool isZero(const D& x, const D& eps) { return ::abs(x) < eps; }
+    static D sqrt(const D& x) { return ::sqrt(x); }
+    static D log(const D& x) { return ::log(x); }
+};
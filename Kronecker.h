@@ -0,0 +1,213 @@
+// =========================================================
+// Kronecker.h — 隐式 Kronecker 积 / Kronecker 和 (Layer 3, 应用层)
+// ---------------------------------------------------------
+// 职责: 只保存因子矩阵，矩阵-向量乘积与求解都不形成 mp x nq 的大矩阵
+// 约定: 长度 n*q 的向量 x 按行主序看作 n x q 矩阵 X (x[i*q + j] = X(i, j))，则
+//       (A ⊗ B) x = vec(A X B^T)，(A ⊕ B) x = vec(A X + X B^T)
+//       内存从 O(n^2 q^2) 降到 O(n^2 + q^2)，乘积从 O(n^2 q^2) 降到 O(nq(n + q))
+// 适用: 二维张量网格上的 PDE 算子 A ⊗ I + I ⊗ B
+// 求解: A ⊗ B 走因子 LU；A ⊕ B 即 Sylvester 方程 A X + X B^T = C，
+//       对称因子用 Jacobi 对角化，非对称因子用 Bartels-Stewart (Sylvester.h)
+// toMatrix() 显式展开，仅供调试与小规模校验
+// =========================================================
+#pragma once
+
+#include "matrix.h"
+#include "vector.h"
+#include "Sylvester.h"
+#include <vector>
+#include <stdexcept>
+#include <optional>
+#include <algorithm>
+
+namespace kronecker_detail {
+
+// 行主序 reshape：长度 r*c 的向量 <-> r x c 矩阵
+template <typename T>
+Matrix<T> unvec(const Vector<T>& x, size_t r, size_t c) {
+    Matrix<T> X(r, c);
+    for (size_t i = 0; i < r; i++)
+        for (size_t j = 0; j < c; j++) X.at(i, j) = x[i * c + j];
+    return X;
+}
+
+template <typename T>
+Vector<T> vec(const Matrix<T>& X) {
+    std::vector<T> out;
+    out.reserve(X.getRows() * X.getCols());
+    for (size_t i = 0; i < X.getRows(); i++)
+        for (size_t j = 0; j < X.getCols(); j++) out.push_back(X.at(i, j));
+    return Vector<T>(std::move(out));
+}
+
+template <typename T>
+T maxAbs(const Matrix<T>& M) {
+    T m = T(0);
+    for (size_t i = 0; i < M.getRows(); i++)
+        for (size_t j = 0; j < M.getCols(); j++) m = std::max(m, ScalarTraits<T>::abs(M.at(i, j)));
+    return m;
+}
+
+template <typename T>
+T maxAbsDiagonal(const Matrix<T>& D) {
+    T m = T(0);
+    for (size_t i = 0; i < D.getRows(); i++) m = std::max(m, ScalarTraits<T>::abs(D.at(i, i)));
+    return m;
+}
+
+// 对称矩阵的循环 Jacobi 对角化：P 正交，PInverse = P^T
+// Matrix::eigen 的 QR 迭代在离散 Laplace 算子这类特征值密集的矩阵上会合并相近的特征值，这里改用 Jacobi
+template <typename T>
+typename Matrix<T>::DiagonalizationResult symmetricDiagonalize(const Matrix<T>& S) {
+    const size_t n = S.getRows();
+    std::vector<T> a(n * n), V(n * n);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < n; j++) a[i * n + j] = S.at(i, j);
+    SmallKernels<T>::jacobiRotate(a.data(), V.data(), n);
+
+    typename Matrix<T>::DiagonalizationResult result;
+    result.D = Matrix<T>::zero(static_cast<int>(n));
+    result.P = Matrix<T>(n, n);
+    for (size_t i = 0; i < n; i++) {
+        result.D.at(i, i) = a[i * n + i];
+        for (size_t j = 0; j < n; j++) result.P.at(i, j) = V[i * n + j];
+    }
+    result.PInverse = result.P.transpose();
+    return result;
+}
+
+}  // namespace kronecker_detail
+
+// A ⊗ B，A 为 m x n，B 为 p x q
+template <typename T>
+class KroneckerProduct {
+private:
+    Matrix<T> A;
+    Matrix<T> B;
+    Matrix<T> Bt;
+    // 求解用的因子 LU，首次 solve 时分解并缓存
+    typename Matrix<T>::LUDecomposition luA;
+    typename Matrix<T>::LUDecomposition luB;
+    bool factored = false;
+
+public:
+    KroneckerProduct(const Matrix<T>& a, const Matrix<T>& b) : A(a), B(b), Bt(b.transpose()) {}
+
+    size_t getRows() const noexcept { return A.getRows() * B.getRows(); }
+    size_t getCols() const noexcept { return A.getCols() * B.getCols(); }
+    const Matrix<T>& getA() const noexcept { return A; }
+    const Matrix<T>& getB() const noexcept { return B; }
+
+    // (A ⊗ B) x = vec(A X B^T)：两次小矩阵乘法
+    Vector<T> operator*(const Vector<T>& x) const {
+        if (x.size() != getCols())
+            throw std::invalid_argument("Matrix columns must match vector size for multiplication");
+        Matrix<T> X = kronecker_detail::unvec(x, A.getCols(), B.getCols());
+        return kronecker_detail::vec(A * X * Bt);
+    }
+
+    // (A ⊗ B)^{-1} = A^{-1} ⊗ B^{-1}：X = A^{-1} C B^{-T}，两个因子各做一次 LU
+    // 奇异判定按各因子自身的量级：|u_kk| <= eps * max|a_ij| (luDecomposition)，与 KroneckerSum 一致
+    Vector<T> solve(const Vector<T>& b, T eps = ScalarTraits<T>::epsilon()) {
+        static_assert(!ScalarTraits<T>::isIntegral, "Kronecker solve requires a field type");
+        if (!A.isSquare() || !B.isSquare()) throw std::domain_error("Must be square");
+        if (b.size() != getRows()) throw std::invalid_argument("Right-hand side size mismatch");
+        if (!factored) {
+            luA = A.luDecomposition(eps);
+            luB = B.luDecomposition(eps);
+            factored = true;
+        }
+        Matrix<T> C = kronecker_detail::unvec(b, A.getRows(), B.getRows());
+        Matrix<T> Z = luA.solve(C);                            // A^{-1} C
+        return kronecker_detail::vec(luB.solve(Z.transpose()).transpose());  // (B^{-1} Z^T)^T
+    }
+
+    // 仅供调试：显式展开为 mp x nq 矩阵
+    Matrix<T> toMatrix() const {
+        const size_t p = B.getRows(), q = B.getCols();
+        Matrix<T> K(getRows(), getCols());
+        for (size_t i = 0; i < A.getRows(); i++)
+            for (size_t j = 0; j < A.getCols(); j++)
+                for (size_t r = 0; r < p; r++)
+                    for (size_t c = 0; c < q; c++) K.at(i * p + r, j * q + c) = A.at(i, j) * B.at(r, c);
+        return K;
+    }
+};
+
+// A ⊕ B = A ⊗ I_q + I_n ⊗ B，A 为 n x n，B 为 q x q
+template <typename T>
+class KroneckerSum {
+private:
+    Matrix<T> A;
+    Matrix<T> B;
+    Matrix<T> Bt;
+    // 求解用的因子分解，首次 solve 时计算并缓存：
+    // A、B 都对称时为正交对角化 A = P Λ P^T, B = Q M Q^T；否则为 A 与 B^T 的实 Schur 分解
+    typename Matrix<T>::DiagonalizationResult diagA;
+    typename Matrix<T>::DiagonalizationResult diagB;
+    std::optional<SylvesterSolver<T>> sylvester;
+    bool factored = false;
+
+public:
+    KroneckerSum(const Matrix<T>& a, const Matrix<T>& b) : A(a), B(b), Bt(b.transpose()) {
+        if (!A.isSquare() || !B.isSquare()) throw std::invalid_argument("Must be square");
+    }
+
+    size_t getRows() const noexcept { return A.getRows() * B.getRows(); }
+    size_t getCols() const noexcept { return getRows(); }
+    const Matrix<T>& getA() const noexcept { return A; }
+    const Matrix<T>& getB() const noexcept { return B; }
+
+    // (A ⊕ B) x = vec(A X + X B^T)
+    Vector<T> operator*(const Vector<T>& x) const {
+        if (x.size() != getCols())
+            throw std::invalid_argument("Matrix columns must match vector size for multiplication");
+        Matrix<T> X = kronecker_detail::unvec(x, A.getRows(), B.getRows());
+        return kronecker_detail::vec(A * X + X * Bt);
+    }
+
+    // 解 A X + X B^T = C；λ_i + μ_j 为零 (A 与 -B 有公共特征值) 时 A ⊕ B 奇异，抛出 domain_error
+    // 对称：令 X = P Y Q^T，得 Λ Y + Y M = P^T C Q，逐元素 Y_ij = C'_ij / (λ_i + μ_j)
+    // 非对称：因子可能不可对角化或有复特征值，交给 SylvesterSolver(A, B^T)
+    // 容差都是相对的：对称性按 eps * max|a_ij| 判定，奇异按 |λ_i + μ_j| <= eps (max|λ| + max|μ|) 判定，
+    // 与 SylvesterSolver 对角块的判定一致；首次调用的 eps 同时作为 SylvesterSolver 的容差
+    Vector<T> solve(const Vector<T>& b, T eps = ScalarTraits<T>::epsilon()) {
+        static_assert(!ScalarTraits<T>::isExact, "KroneckerSum solve requires a floating-point type");
+        if (b.size() != getRows()) throw std::invalid_argument("Right-hand side size mismatch");
+        if (!factored) {
+            if (A.isSymmetric(eps * kronecker_detail::maxAbs(A)) && B.isSymmetric(eps * kronecker_detail::maxAbs(B))) {
+                diagA = kronecker_detail::symmetricDiagonalize(A);
+                diagB = kronecker_detail::symmetricDiagonalize(B);
+            } else {
+                sylvester.emplace(A, Bt, eps);
+            }
+            factored = true;
+        }
+        const size_t n = A.getRows(), q = B.getRows();
+        Matrix<T> C = kronecker_detail::unvec(b, n, q);
+        if (sylvester) return kronecker_detail::vec(sylvester->solve(C));
+        Matrix<T> Y = diagA.PInverse * C * diagB.PInverse.transpose();
+        const T tol = eps * (kronecker_detail::maxAbsDiagonal(diagA.D) + kronecker_detail::maxAbsDiagonal(diagB.D));
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < q; j++) {
+                T d = diagA.D.at(i, i) + diagB.D.at(j, j);
+                if (!(ScalarTraits<T>::abs(d) > tol)) throw std::domain_error("Kronecker sum is singular");
+                Y.at(i, j) /= d;
+            }
+        }
+        return kronecker_detail::vec(diagA.P * Y * diagB.P.transpose());
+    }
+
+    // 仅供调试：显式展开为 nq x nq 矩阵
+    Matrix<T> toMatrix() const {
+        const size_t n = A.getRows(), q = B.getRows();
+        Matrix<T> K(n * q, n * q);
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++)
+                for (size_t r = 0; r < q; r++) K.at(i * q + r, j * q + r) += A.at(i, j);
+            for (size_t r = 0; r < q; r++)
+                for (size_t c = 0; c < q; c++) K.at(i * q + r, i * q + c) += B.at(r, c);
+        }
+        return K;
+    }
+};
@@ -0,0 +1,178 @@
+// =========================================================
+// Krylov.h — 矩阵指数作用于向量 e^{tA} v (Layer 3, 应用层)
+// ---------------------------------------------------------
+// 职责: 只通过矩阵-向量乘积求 e^{tA} v，不形成稠密的 e^{tA}
+// 实现: Arnoldi (对称时退化为 Lanczos 三项递推) 建出 Krylov 子空间
+//       K_m = span{v, Av, ..., A^{m-1} v} 的正交基 V_m 与 H_m = V_m^T A V_m，
+//       e^{tA} v ≈ β V_m e^{t H_m} e_1，只需对 m x m 的小矩阵调用 Matrix::exp()
+// 复用: 基只与 A、v 有关，与 t 无关；同一对象对多个 t 求值时只补充不足的维数
+// 适用: 大规模 / 稀疏 A (矩阵-向量乘积由调用方以 Operator 形式提供)
+// =========================================================
+#pragma once
+
+#include "matrix.h"
+#include "vector.h"
+#include <vector>
+#include <cmath>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+
+template <typename T>
+class KrylovExpm {
+public:
+    using Operator = std::function<Vector<T>(const Vector<T>&)>;
+
+private:
+    static_assert(!ScalarTraits<T>::isExact, "KrylovExpm requires a floating-point type");
+
+    Operator op;
+    size_t n;
+    bool symmetric;
+    T tol;                         // 相对 ||v|| 的误差容限
+    size_t maxDim;                 // 单个 Krylov 子空间的维数上限
+    T beta = 0;                    // ||v||
+    std::vector<Vector<T>> basis;  // 正交基 v_0 .. v_m
+    std::vector<std::vector<T>> h; // H 按列存储，h[j] 长度 j + 2
+    bool invariant = false;        // 幸运中断：子空间对 A 不变，近似在舍入意义下精确
+    size_t matvecs = 0;
+
+    size_t limit() const { return std::min(n, maxDim); }
+
+    // 把子空间扩到 target 维 (Arnoldi / Lanczos 的第 j 步产生 H 的第 j 列)
+    void extend(size_t target) {
+        target = std::min(target, limit());
+        while (h.size() < target && !invariant) {
+            const size_t j = h.size();
+            Vector<T> w = op(basis[j]);
+            matvecs++;
+            if (w.size() != n) throw std::invalid_argument("Operator result size mismatch");
+            const T scale = w.norm();
+
+            std::vector<T> col(j + 2, T(0));
+            // 对称时 H 是三对角阵，只需对前两个基向量正交化；否则做两遍修正 Gram-Schmidt 保持正交性
+            const size_t first = symmetric && j > 0 ? j - 1 : 0;
+            const int passes = symmetric ? 1 : 2;
+            for (int pass = 0; pass < passes; pass++) {
+                for (size_t i = first; i <= j; i++) {
+                    T c = basis[i].dot(w);
+                    col[i] += c;
+                    w -= basis[i] * c;
+                }
+            }
+            if (symmetric && j > 0) col[j - 1] = h[j - 1][j];  // H 对称，抵消舍入带来的不对称
+
+            T next = w.norm();
+            col[j + 1] = next;
+            h.push_back(std::move(col));
+            if (!(next > scale * tol * T(1e-2))) {
+                invariant = true;
+                break;
+            }
+            basis.push_back(w * (T(1) / next));
+        }
+    }
+
+    // e^{t H_m}，H_m 取 H 的前 m 行 m 列
+    Matrix<T> smallExp(T t, size_t m) const {
+        Matrix<T> H(m, m);
+        for (size_t j = 0; j < m; j++)
+            for (size_t i = 0; i <= std::min(j + 1, m - 1); i++) H.at(i, j) = t * h[j][i];
+        return H.exp();
+    }
+
+    // 截断误差估计 (Saad)：β |t| h_{m+1,m} |e_m^T e^{t H_m} e_1|
+    T estimate(T t, const Matrix<T>& E, size_t m) const {
+        if (invariant) return T(0);
+        return beta * ScalarTraits<T>::abs(t) * h[m - 1][m] * ScalarTraits<T>::abs(E.at(m - 1, 0));
+    }
+
+    Vector<T> combine(const Matrix<T>& E, size_t m) const {
+        Vector<T> result(n, T(0));
+        for (size_t k = 0; k < m; k++) result += basis[k] * (beta * E.at(k, 0));
+        return result;
+    }
+
+    // 在当前子空间上尽量推进：先按需扩维，仍不够则把步长减半；
+    // 返回 e^{done·A} v，done 等于 t 或其 2 的负幂倍
+    Vector<T> advance(T t, T& done) {
+        done = t;
+        if (beta == T(0) || t == T(0)) return basis.empty() ? Vector<T>(n, T(0)) : basis[0] * beta;
+
+        size_t m = h.size();
+        for (;;) {
+            Matrix<T> E = smallExp(t, m);
+            if (estimate(t, E, m) <= tol * beta) return combine(E, m);
+            if (invariant || m >= limit()) break;
+            extend(std::max(m + 8, 2 * m));
+            m = h.size();
+        }
+
+        for (int halvings = 0; halvings < 200; halvings++) {
+            done = done / T(2);
+            Matrix<T> E = smallExp(done, m);
+            if (estimate(done, E, m) <= tol * beta) return combine(E, m);
+        }
+        throw std::domain_error("Krylov exponential failed to reach tolerance");
+    }
+
+public:
+    // op 计算 A x；symmetric 为真时使用 Lanczos 三项递推
+    KrylovExpm(Operator applyA, const Vector<T>& v, T tolerance = T(1e-12), size_t maxDimension = 64,
+               bool isSymmetric = false)
+        : op(std::move(applyA)), n(v.size()), symmetric(isSymmetric), tol(tolerance), maxDim(maxDimension) {
+        if (n == 0) throw std::invalid_argument("Vector cannot be empty");
+        if (maxDim == 0) throw std::invalid_argument("Krylov dimension must be positive");
+        if (!(tol > T(0))) throw std::invalid_argument("Tolerance must be positive");
+        beta = v.norm();
+        if (beta == T(0)) {
+            invariant = true;
+            return;
+        }
+        basis.push_back(v * (T(1) / beta));
+        extend(std::min<size_t>(limit(), 8));
+    }
+
+    // 稠密矩阵：按副本保存 A，对称性按 eps * max|a_ij| 相对判定 (整体很小的非对称矩阵不能误走 Lanczos)
+    KrylovExpm(const Matrix<T>& A, const Vector<T>& v, T tolerance = T(1e-12), size_t maxDimension = 64)
+        : KrylovExpm(makeOperator(A, v), v, tolerance, maxDimension, isRelativelySymmetric(A)) {}
+
+    // e^{tA} v；t 过大使单个子空间不够用时分步推进，每一步在新的起始向量上重建子空间
+    Vector<T> apply(T t) {
+        T done;
+        Vector<T> w = advance(t, done);
+        T remaining = t - done;
+        while (remaining != T(0)) {
+            KrylovExpm step(op, w, tol, maxDim, symmetric);
+            w = step.advance(remaining, done);
+            matvecs += step.matvecs;
+            remaining = remaining - done;
+        }
+        return w;
+    }
+
+    std::vector<Vector<T>> apply(const std::vector<T>& times) {
+        std::vector<Vector<T>> results;
+        results.reserve(times.size());
+        for (const T& t : times) results.push_back(apply(t));
+        return results;
+    }
+
+    size_t dimension() const noexcept { return h.size(); }
+    size_t matvecCount() const noexcept { return matvecs; }
+    bool isInvariant() const noexcept { return invariant; }
+
+private:
+    static Operator makeOperator(const Matrix<T>& A, const Vector<T>& v) {
+        if (A.getRows() != A.getCols()) throw std::invalid_argument("Matrix must be square");
+        if (A.getCols() != v.size()) throw std::invalid_argument("Matrix columns must match vector size");
+        return [A](const Vector<T>& x) { return A * x; };
+    }
+
+    static bool isRelativelySymmetric(const Matrix<T>& A) {
+        T maxAbs = T(0);
+        for (size_t i = 0; i < A.getRows(); i++)
+            for (size_t j = 0; j < A.getCols(); j++) maxAbs = std::max(maxAbs, ScalarTraits<T>::abs(A.at(i, j)));
+        return A.isSymmetric(ScalarTraits<T>::epsilon() * maxAbs);
+    }
+};
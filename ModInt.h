@@ -0,0 +1,128 @@
+// =========================================================
+// ModInt.h — 有限域 GF(p) 标量 (Layer 0)
+// ---------------------------------------------------------
+// 职责: 提供可直接代入 Matrix<T> / RREF<T> / SolvingEquation<T> / VectorSet<T> 的有限域标量
+// 实现: Montgomery 乘法 (R = 2^32)，值以 Montgomery 形式存储，乘法不做 64 位取模
+// 要求: P 为奇素数且 P < 2^31 (编译期检查)
+// 判零是精确的 x == 0，整数方程组的秩与可解性判定比有理数运算便宜得多
+// 常用素数: 998244353, 1000000007, 2147483647
+// =========================================================
+#pragma once
+
+#include "ScalarTraits.h"
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+
+template <uint32_t P>
+class ModInt {
+private:
+    static constexpr bool isPrime(uint32_t n) {
+        if (n < 2) return false;
+        for (uint64_t d = 2; d * d <= n; d++) {
+            if (n % d == 0) return false;
+        }
+        return true;
+    }
+
+    static_assert(P > 2 && P < (1u << 31), "ModInt: modulus must be an odd prime below 2^31");
+    static_assert(isPrime(P), "ModInt: modulus must be prime");
+
+    // -P^{-1} mod 2^32 (Newton 迭代求逆)
+    static constexpr uint32_t negInv() {
+        uint32_t inv = P;
+        for (int i = 0; i < 5; i++) inv *= 2u - P * inv;
+        return 0u - inv;
+    }
+
+    static constexpr uint32_t nInv = negInv();
+    static constexpr uint32_t r2 = static_cast<uint32_t>((static_cast<unsigned __int128>(1) << 64) % P); // R^2 mod P
+
+    uint32_t v = 0;  // Montgomery 形式 x * R mod P
+
+    // Montgomery 约化：返回 t * R^{-1} mod P，要求 t < P * 2^32
+    static uint32_t reduce(uint64_t t) {
+        uint32_t m = static_cast<uint32_t>(t) * nInv;
+        uint32_t r = static_cast<uint32_t>((t + static_cast<uint64_t>(m) * P) >> 32);
+        return r >= P ? r - P : r;
+    }
+
+    struct Raw {};
+    ModInt(uint32_t mont, Raw) : v(mont) {}
+
+public:
+    ModInt() = default;
+
+    template <typename I, typename = std::enable_if_t<std::is_integral_v<I>>>
+    ModInt(I x) {
+        long long r;
+        if constexpr (std::is_signed_v<I>) {
+            r = static_cast<long long>(x) % static_cast<long long>(P);
+            if (r < 0) r += P;
+        } else {
+            r = static_cast<long long>(static_cast<unsigned long long>(x) % P);
+        }
+        v = reduce(static_cast<uint64_t>(r) * r2);
+    }
+
+    static constexpr uint32_t modulus() noexcept { return P; }
+
+    // 标准代表元 [0, P)
+    uint32_t value() const { return reduce(v); }
+
+    ModInt operator-() const { return ModInt(v == 0 ? 0 : P - v, Raw{}); }
+
+    friend ModInt operator+(const ModInt& a, const ModInt& b) {
+        uint32_t s = a.v + b.v;
+        return ModInt(s >= P ? s - P : s, Raw{});
+    }
+
+    friend ModInt operator-(const ModInt& a, const ModInt& b) {
+        return ModInt(a.v >= b.v ? a.v - b.v : a.v + P - b.v, Raw{});
+    }
+
+    friend ModInt operator*(const ModInt& a, const ModInt& b) {
+        return ModInt(reduce(static_cast<uint64_t>(a.v) * b.v), Raw{});
+    }
+
+    ModInt pow(uint64_t e) const {
+        ModInt base = *this, r(1);
+        while (e) {
+            if (e & 1) r = r * base;
+            base = base * base;
+            e >>= 1;
+        }
+        return r;
+    }
+
+    // 费马小定理求逆
+    ModInt inverse() const {
+        if (v == 0) throw std::domain_error("ModInt division by zero");
+        return pow(P - 2);
+    }
+
+    friend ModInt operator/(const ModInt& a, const ModInt& b) { return a * b.inverse(); }
+
+    ModInt& operator+=(const ModInt& o) { return *this = *this + o; }
+    ModInt& operator-=(const ModInt& o) { return *this = *this - o; }
+    ModInt& operator*=(const ModInt& o) { return *this = *this * o; }
+    ModInt& operator/=(const ModInt& o) { return *this = *this / o; }
+
+    // Montgomery 形式是双射，直接比较即可
+    friend bool operator==(const ModInt& a, const ModInt& b) { return a.v == b.v; }
+    friend bool operator!=(const ModInt& a, const ModInt& b) { return a.v != b.v; }
+
+    friend std::ostream& operator<<(std::ostream& os, const ModInt& a) { return os << a.value(); }
+};
+
+template <uint32_t P>
+struct ScalarTraits<ModInt<P>> {
+    using F = ModInt<P>;
+    static constexpr bool isExact = true;
+    static constexpr bool isIntegral = false;
+    static F epsilon() { return F(0); }
+    // 有限域没有大小之分，选主元时只区分零与非零
+    static unsigned magnitude(const F& x) { return x == F(0) ? 0u : 1u; }
+    static bool isZero(const F& x, const F&) { return x == F(0); }
+};
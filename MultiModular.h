@@ -0,0 +1,212 @@
+// =========================================================
+// MultiModular.h — 多模 (CRT) 精确秩与行列式 (Layer 2)
+// ---------------------------------------------------------
+// 职责: 整数矩阵在若干字长素数 p 下分别做 GF(p) 消元，
+//       再用中国剩余定理 (Garner) 重建精确行列式
+// 每个 p < 2^26：剩余以 double 存储，乘积 < 2^52 可精确表示，
+//       行更新是纯浮点乘加 + floor 约化，循环可被编译器向量化
+// 不同素数之间完全独立，按批分给多个线程
+// 系数增长只体现在素数个数上，单个素数下的消元与浮点消元同速
+// =========================================================
+#pragma once
+
+#include "matrix.h"
+#include "BigInt.h"
+#include "Parallel.h"
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+class MultiModular {
+public:
+    // 行列式 (要求方阵)：默认在 CRT 重建值连续 stableRounds 个新素数都不变时提前结束，
+    // 每多一个素数出错概率约乘 2^-25；certified = true 时一直累加到模数超过 2 * Hadamard 界，结果确定正确
+    template <typename T>
+    static BigInt determinant(const Matrix<T>& A, bool certified = false, size_t stableRounds = 2) {
+        if (!A.isSquare()) throw std::domain_error("Must be square");
+        const size_t n = A.getRows();
+
+        // log2(Hadamard 界) = sum_i log2 ||row_i||_2，决定最多需要多少个素数
+        long double log2Bound = 0;
+        for (size_t i = 0; i < n; i++) {
+            long double sq = 0;
+            for (size_t j = 0; j < n; j++) {
+                long double v = static_cast<long double>(A.at(i, j));
+                sq += v * v;
+            }
+            if (sq == 0) return BigInt(0);
+            log2Bound += 0.5L * std::log2(sq);
+        }
+        const std::vector<uint32_t> ps = primesBelow(primeBound, static_cast<size_t>(
+            std::ceil((log2Bound + 2) / std::log2(static_cast<long double>(primeBound) / 2))) + 1);
+
+        const size_t batch = std::max<size_t>(2, parallelConcurrency());
+        BigInt X(0), M(1), lastSymmetric(0);
+        long double log2M = 0;
+        size_t stable = 0;
+
+        for (size_t start = 0; start < ps.size(); start += batch) {
+            const size_t end = std::min(ps.size(), start + batch);
+            std::vector<uint32_t> residues(end - start);
+            parallelFor(start, end, 1, [&](size_t lo, size_t hi) {
+                for (size_t k = lo; k < hi; k++) {
+                    Residues a = reduce(A, ps[k]);
+                    uint32_t det = 0;
+                    eliminate(a, ps[k], det);
+                    residues[k - start] = det;
+                }
+            });
+
+            for (size_t k = start; k < end; k++) {
+                const uint32_t p = ps[k];
+                // Garner: X' = X + M * ((r - X) * M^{-1} mod p)
+                uint32_t xModP = static_cast<uint32_t>((X % BigInt(p)).toInt64());
+                uint32_t mModP = static_cast<uint32_t>((M % BigInt(p)).toInt64());
+                uint64_t diff = (static_cast<uint64_t>(residues[k - start]) + p - xModP) % p;
+                uint64_t t = diff * invMod(mModP, p) % p;
+                X += M * BigInt(t);
+                M *= BigInt(p);
+                log2M += std::log2(static_cast<long double>(p));
+
+                BigInt symmetric = (X + X > M) ? X - M : X;
+                if (log2M > log2Bound + 1) return symmetric;
+                if (!certified) {
+                    stable = (k > 0 && symmetric == lastSymmetric) ? stable + 1 : 0;
+                    if (stable >= stableRounds) return symmetric;
+                }
+                lastSymmetric = std::move(symmetric);
+            }
+        }
+        return (X + X > M) ? X - M : X;
+    }
+
+    // 秩：GF(p) 上的秩不超过有理数域上的秩，只有 p 整除全部 r 阶子式时才会偏小
+    // 取 trials 个互不相同的伪随机素数下的最大值；种子固定，同一输入每次结果相同
+    template <typename T>
+    static size_t rank(const Matrix<T>& A, size_t trials = 3) {
+        std::mt19937 gen(rankSeed);
+        std::uniform_int_distribution<uint32_t> dist(primeBound / 2, primeBound - 1);
+        std::vector<uint32_t> ps;
+        while (ps.size() < std::max<size_t>(1, trials)) {
+            const uint32_t p = primesBelow(dist(gen), 1)[0];
+            if (std::find(ps.begin(), ps.end(), p) == ps.end()) ps.push_back(p);
+        }
+
+        std::vector<size_t> ranks(ps.size(), 0);
+        parallelFor(0, ps.size(), 1, [&](size_t lo, size_t hi) {
+            for (size_t k = lo; k < hi; k++) {
+                Residues a = reduce(A, ps[k]);
+                uint32_t det = 0;
+                ranks[k] = eliminate(a, ps[k], det);
+            }
+        });
+        return *std::max_element(ranks.begin(), ranks.end());
+    }
+
+private:
+    using Residues = std::vector<std::vector<double>>;
+
+    static constexpr uint32_t primeBound = 1u << 26;
+    static constexpr uint32_t rankSeed = 20240531u;
+
+    static bool isPrime(uint32_t x) {
+        if (x < 2) return false;
+        if (x % 2 == 0) return x == 2;
+        for (uint32_t d = 3; d * d <= x; d += 2) {
+            if (x % d == 0) return false;
+        }
+        return true;
+    }
+
+    // 小于 bound 的最大的 count 个素数 (从大到小)
+    static std::vector<uint32_t> primesBelow(uint32_t bound, size_t count) {
+        std::vector<uint32_t> ps;
+        for (uint32_t x = bound - 1; ps.size() < count && x >= 3; x--) {
+            if (isPrime(x)) ps.push_back(x);
+        }
+        return ps;
+    }
+
+    static uint32_t powMod(uint64_t a, uint64_t e, uint32_t p) {
+        uint64_t r = 1;
+        a %= p;
+        while (e) {
+            if (e & 1) r = r * a % p;
+            a = a * a % p;
+            e >>= 1;
+        }
+        return static_cast<uint32_t>(r);
+    }
+
+    static uint32_t invMod(uint32_t a, uint32_t p) { return powMod(a, p - 2, p); }
+
+    template <typename T>
+    static Residues reduce(const Matrix<T>& A, uint32_t p) {
+        static_assert(ScalarTraits<T>::isIntegral, "MultiModular requires an integer matrix");
+        Residues a(A.getRows(), std::vector<double>(A.getCols()));
+        for (size_t i = 0; i < A.getRows(); i++) {
+            for (size_t j = 0; j < A.getCols(); j++) {
+                long long r;
+                // 内置整数一律提升到 64 位再取模：窄类型装不下 p (static_cast<T>(p) 会截断)
+                if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T>)
+                    r = static_cast<long long>(static_cast<unsigned long long>(A.at(i, j)) % p);
+                else if constexpr (std::is_integral_v<T>) r = static_cast<long long>(A.at(i, j)) % static_cast<long long>(p);
+                else r = (A.at(i, j) % BigInt(p)).toInt64();
+                if (r < 0) r += p;
+                a[i][j] = static_cast<double>(r);
+            }
+        }
+        return a;
+    }
+
+    // GF(p) 上的行阶梯化，返回秩；方阵满秩时 det 为行列式 mod p，否则为 0
+    static size_t eliminate(Residues& a, uint32_t p, uint32_t& det) {
+        const size_t rows = a.size();
+        const size_t cols = a.empty() ? 0 : a[0].size();
+        const double pd = static_cast<double>(p);
+        const double invP = 1.0 / pd;
+        uint64_t detAcc = 1;
+        bool negate = false;
+        size_t pivotRow = 0;
+
+        for (size_t col = 0; col < cols && pivotRow < rows; col++) {
+            size_t piv = pivotRow;
+            while (piv < rows && a[piv][col] == 0) piv++;
+            if (piv == rows) continue;
+            if (piv != pivotRow) {
+                std::swap(a[piv], a[pivotRow]);
+                negate = !negate;
+            }
+
+            const std::vector<double>& pr = a[pivotRow];
+            const uint32_t pivot = static_cast<uint32_t>(pr[col]);
+            detAcc = detAcc * pivot % p;
+            const uint64_t inv = invMod(pivot, p);
+
+            for (size_t row = pivotRow + 1; row < rows; row++) {
+                std::vector<double>& r = a[row];
+                if (r[col] == 0) continue;
+                // r <- r - f * pr，f = r[col] / pivot；元素 < 2^26，乘加结果 < 2^53 精确
+                const double nf = static_cast<double>(p - static_cast<uint32_t>(static_cast<uint64_t>(r[col]) * inv % p));
+                for (size_t j = col; j < cols; j++) {
+                    double x = r[j] + nf * pr[j];
+                    x -= std::floor(x * invP) * pd;
+                    if (x < 0) x += pd;
+                    else if (x >= pd) x -= pd;
+                    r[j] = x;
+                }
+            }
+            pivotRow++;
+        }
+
+        det = 0;
+        if (rows == cols && pivotRow == rows) {
+            det = static_cast<uint32_t>(negate ? (p - detAcc) % p : detAcc);
+        }
+        return pivotRow;
+    }
+};
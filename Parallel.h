@@ -0,0 +1,152 @@
+// =========================================================
+// Parallel.h — 轻量并行工具 (Layer 0, 无项目内依赖)
+// ---------------------------------------------------------
+// 职责: 把独立的循环区间切块分给常驻线程池执行
+// 区间较小或单核时直接串行，调用方无需关心线程数
+// 线程池在第一次并行调用时创建、按需增长，之后每次调用只是入队 + 唤醒，
+// 不再逐次创建 / 回收 std::thread (每次约数十微秒，消元时每个主元一次)
+// =========================================================
+#pragma once
+
+#include <thread>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+#include <cstddef>
+
+namespace parallel_detail {
+
+inline std::atomic<size_t>& concurrencySetting() {
+    static std::atomic<size_t> n{0};
+    return n;
+}
+
+// 常驻线程池：调用线程自己也领取块，只等待已被其他线程领走的块；
+// 因此块内再次调用 parallelFor (嵌套) 不会因线程耗尽而死锁
+class ThreadPool {
+private:
+    struct Job {
+        const std::function<void(size_t)>* run;
+        size_t chunks;
+        std::atomic<size_t> next{0};
+        size_t done = 0;  // 受 lock 保护
+        std::exception_ptr error;
+        std::condition_variable finished;
+    };
+
+    std::mutex lock;
+    std::condition_variable wake;
+    std::deque<std::shared_ptr<Job>> queue;
+    std::vector<std::thread> threads;
+    bool stopping = false;
+
+    // 领取并执行 job 中剩余的块；块内异常只保留第一个
+    void work(Job& job) {
+        for (size_t c; (c = job.next.fetch_add(1)) < job.chunks;) {
+            std::exception_ptr error;
+            try {
+                (*job.run)(c);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            std::lock_guard<std::mutex> guard(lock);
+            if (error && !job.error) job.error = error;
+            if (++job.done == job.chunks) job.finished.notify_all();
+        }
+    }
+
+    void loop() {
+        std::unique_lock<std::mutex> guard(lock);
+        while (true) {
+            wake.wait(guard, [this] { return stopping || !queue.empty(); });
+            if (stopping) return;
+            std::shared_ptr<Job> job = queue.front();
+            if (job->next.load() >= job->chunks) {
+                queue.pop_front();
+                continue;
+            }
+            guard.unlock();
+            work(*job);
+            guard.lock();
+        }
+    }
+
+    ThreadPool() = default;
+
+public:
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& t : threads) t.join();
+    }
+
+    static ThreadPool& instance() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    // 执行 run(0) .. run(chunks - 1)，全部结束后返回；有块抛出则在此重新抛出
+    void execute(size_t chunks, const std::function<void(size_t)>& run) {
+        auto job = std::make_shared<Job>();
+        job->run = &run;
+        job->chunks = chunks;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            while (threads.size() + 1 < chunks) threads.emplace_back([this] { loop(); });
+            queue.push_back(job);
+        }
+        wake.notify_all();
+        work(*job);
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            job->finished.wait(guard, [&job] { return job->done == job->chunks; });
+            auto it = std::find(queue.begin(), queue.end(), job);
+            if (it != queue.end()) queue.erase(it);
+        }
+        if (job->error) std::rethrow_exception(job->error);
+    }
+};
+
+}  // namespace parallel_detail
+
+// 并行线程数：默认 hardware_concurrency；n = 0 恢复默认
+// 切块方式只取决于这个值与 grain，可用来在单核机器上复现多线程的切块
+inline void setParallelConcurrency(size_t n) { parallel_detail::concurrencySetting().store(n); }
+
+inline size_t parallelConcurrency() {
+    size_t n = parallel_detail::concurrencySetting().load();
+    return n ? n : std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+// body(lo, hi) 处理 [lo, hi)；每个线程至少分到 grain 个元素
+// 各块之间必须互不写同一数据；body 抛出的 (第一个) 异常在所有块结束后于调用线程重新抛出
+template <typename Func>
+void parallelFor(size_t begin, size_t end, size_t grain, Func&& body) {
+    if (end <= begin) return;
+    size_t total = end - begin;
+    size_t workers = std::min(parallelConcurrency(), (total + grain - 1) / std::max<size_t>(grain, 1));
+    if (workers <= 1) {
+        body(begin, end);
+        return;
+    }
+
+    size_t chunk = (total + workers - 1) / workers;
+    size_t chunks = (total + chunk - 1) / chunk;
+    std::function<void(size_t)> run = [&body, begin, end, chunk](size_t c) {
+        size_t lo = begin + c * chunk;
+        body(lo, std::min(end, lo + chunk));
+    };
+    parallel_detail::ThreadPool::instance().execute(chunks, run);
+}
@@ -7,8 +7,187 @@
 #include <algorithm> 
 #include "VectorSet.h"
 
-template <typename T>
+// -------- 主元选择策略 --------
+// RREF<T, Pivoting> 的第二个模板参数。每个策略给出嵌套的 Search<T>，保存一次消元期间的搜索状态：
+//   只选行的策略 (permutesColumns = false)：prepare / swapRows / selectRow(a, first, col)
+//   同时选列的策略 (permutesColumns = true)：prepare / swapRows / rowUpdated / selectPivot
+// 整数类型走 Bareiss 精确消元，没有舍入误差，策略不起作用
+
+// 部分主元：当前列中绝对值最大者 (默认)
+struct PartialPivoting {
+    static constexpr bool permutesColumns = false;
+
+    template <typename T>
+    class Search {
+    public:
+        void prepare(const std::vector<std::vector<T>>&) {}
+        void swapRows(size_t, size_t) {}
+
+        size_t selectRow(const std::vector<std::vector<T>>& a, size_t first, size_t col) const {
+            size_t best = first;
+            auto bestVal = ScalarTraits<T>::magnitude(a[first][col]);
+            for (size_t r = first + 1; r < a.size(); r++) {
+                auto v = ScalarTraits<T>::magnitude(a[r][col]);
+                if (v > bestVal) {
+                    bestVal = v;
+                    best = r;
+                }
+            }
+            return best;
+        }
+    };
+};
+
+// 按行缩放的部分主元：比较 |a_rc| / s_r，s_r 为原矩阵第 r 行的最大绝对值。
+// 各行量级相差悬殊时不会被大行主导；s_r 只在消元前算一次，随行交换，每次选主元仍是 O(rows)
+struct ScaledPartialPivoting {
+    static constexpr bool permutesColumns = false;
+
+    template <typename T>
+    class Search {
+        using Mag = decltype(ScalarTraits<T>::magnitude(std::declval<T>()));
+        std::vector<Mag> scales;
+
+    public:
+        void prepare(const std::vector<std::vector<T>>& a) {
+            scales.assign(a.size(), Mag(0));
+            for (size_t r = 0; r < a.size(); r++)
+                for (const T& x : a[r]) scales[r] = std::max(scales[r], ScalarTraits<T>::magnitude(x));
+        }
+
+        void swapRows(size_t r1, size_t r2) { std::swap(scales[r1], scales[r2]); }
+
+        // |a_rc| / s_r > |a_bc| / s_b 交叉相乘比较，不做除法；零行 (s_r = 0) 永不入选
+        size_t selectRow(const std::vector<std::vector<T>>& a, size_t first, size_t col) const {
+            size_t best = first;
+            auto bestVal = ScalarTraits<T>::magnitude(a[first][col]);
+            for (size_t r = first + 1; r < a.size(); r++) {
+                if (scales[r] == Mag(0)) continue;
+                auto v = ScalarTraits<T>::magnitude(a[r][col]);
+                if (scales[best] == Mag(0) ? v > Mag(0) : v * scales[best] > bestVal * scales[r]) {
+                    bestVal = v;
+                    best = r;
+                }
+            }
+            return best;
+        }
+    };
+};
+
+// Rook 主元：主元同时是所在行与所在列的最大者。从第一个未用列出发，交替取列最大、行最大，
+// 每一步严格增大，通常两三次即停，每个主元 O(rows + cols)；增长因子界接近完全主元
+struct RookPivoting {
+    static constexpr bool permutesColumns = true;
+    static constexpr bool searchesWholeBlock = false;
+
+    template <typename T>
+    class Search {
+    public:
+        void prepare(const std::vector<std::vector<T>>&, const std::vector<char>&) {}
+        void swapRows(size_t, size_t) {}
+        void rowUpdated(const std::vector<std::vector<T>>&, size_t, const std::vector<char>&) {}
+
+        void selectPivot(const std::vector<std::vector<T>>& a, size_t first, const std::vector<char>& active,
+                         size_t& row, size_t& col) const {
+            col = 0;
+            while (!active[col]) col++;
+            row = first;
+            auto best = ScalarTraits<T>::magnitude(a[first][col]);
+            for (size_t r = first + 1; r < a.size(); r++) {
+                auto v = ScalarTraits<T>::magnitude(a[r][col]);
+                if (v > best) {
+                    best = v;
+                    row = r;
+                }
+            }
+            for (;;) {
+                size_t nextCol = col;
+                for (size_t j = 0; j < active.size(); j++) {
+                    if (!active[j]) continue;
+                    auto v = ScalarTraits<T>::magnitude(a[row][j]);
+                    if (v > best) {
+                        best = v;
+                        nextCol = j;
+                    }
+                }
+                if (nextCol == col) return;
+                col = nextCol;
+                size_t nextRow = row;
+                for (size_t r = first; r < a.size(); r++) {
+                    auto v = ScalarTraits<T>::magnitude(a[r][col]);
+                    if (v > best) {
+                        best = v;
+                        nextRow = r;
+                    }
+                }
+                if (nextRow == row) return;
+                row = nextRow;
+            }
+        }
+    };
+};
+
+// 完全主元：剩余子阵中绝对值最大者。每行的最大元 (值, 列) 在该行被消元更新后立即重算，
+// 此时该行仍在缓存中，选主元只需比较 O(rows) 个行最大值，而不必每步重扫整个子阵
+struct CompletePivoting {
+    static constexpr bool permutesColumns = true;
+    static constexpr bool searchesWholeBlock = true;
+
+    template <typename T>
+    class Search {
+        using Mag = decltype(ScalarTraits<T>::magnitude(std::declval<T>()));
+        std::vector<Mag> rowMax;
+        std::vector<size_t> rowArg;
+
+    public:
+        void prepare(const std::vector<std::vector<T>>& a, const std::vector<char>& active) {
+            rowMax.assign(a.size(), Mag(0));
+            rowArg.assign(a.size(), 0);
+            for (size_t r = 0; r < a.size(); r++) rowUpdated(a, r, active);
+        }
+
+        void swapRows(size_t r1, size_t r2) {
+            std::swap(rowMax[r1], rowMax[r2]);
+            std::swap(rowArg[r1], rowArg[r2]);
+        }
+
+        // 只写第 r 项，可在按行块并行的消元中直接调用
+        void rowUpdated(const std::vector<std::vector<T>>& a, size_t r, const std::vector<char>& active) {
+            bool found = false;
+            for (size_t j = 0; j < active.size(); j++) {
+                if (!active[j]) continue;
+                auto v = ScalarTraits<T>::magnitude(a[r][j]);
+                if (!found || v > rowMax[r]) {
+                    rowMax[r] = v;
+                    rowArg[r] = j;
+                    found = true;
+                }
+            }
+        }
+
+        void selectPivot(const std::vector<std::vector<T>>&, size_t first, const std::vector<char>&,
+                         size_t& row, size_t& col) const {
+            row = first;
+            for (size_t r = first + 1; r < rowMax.size(); r++)
+                if (rowMax[r] > rowMax[row]) row = r;
+            col = rowArg[row];
+        }
+    };
+};
+
+template <typename T, typename Pivoting>
 class RREF {
+public:
+    // 一次初等行变换：Swap 交换 target / source 两行，Scale 为 target *= factor，
+    // AddScaled 为 target += factor * source
+    struct RowOperation {
+        enum class Kind { Swap, Scale, AddScaled };
+        Kind kind;
+        size_t target;
+        size_t source;
+        T factor;
+    };
+
 private:
     Matrix<T> mat;
     size_t rank = 0;
@@ -16,83 +195,450 @@ private:
     std::vector<size_t> pivotRows;
     bool isREF = false;
     bool isRREF = false;
+    // 主元公共值：浮点/有理数化简后主元为 1；整数走无除法消元时主元均为 d (最后一个 Bareiss 主元)
+    T pivotScale = T(1);
+    // 行变换日志 (recordOperations 开启后记录)：appendColumn 把新列按日志重放到当前坐标系
+    bool recording = false;
+    std::vector<RowOperation> operations;
+    // 主元搜索状态 (缩放因子、行最大值等)，每次 toREF 重新 prepare
+    typename Pivoting::template Search<T> search;
 
-public:
-    RREF(const Matrix<T>& inputMat) : mat(inputMat), rank(0) {}
+    // -------- 带日志的行变换 --------
+    void swapRows(size_t r1, size_t r2) {
+        if (r1 == r2) return;
+        mat.exchangeRows(r1, r2);
+        if (recording) operations.push_back({RowOperation::Kind::Swap, r1, r2, T(0)});
+    }
+
+    // 直接逐元素缩放：Matrix::scaleRow 拒绝小于 epsilon 的系数，而主元大于 1/epsilon 时正需要这样的系数
+    void scaleRow(size_t r, T factor) {
+        for (T& x : mat.data[r]) x *= factor;
+        if (recording) operations.push_back({RowOperation::Kind::Scale, r, r, factor});
+    }
+
+    // 与 Matrix::addScaledRow 相同，系数可忽略时不做也不记录
+    void addScaledRow(size_t target, size_t source, T factor) {
+        if (ScalarTraits<T>::isZero(factor, ScalarTraits<T>::epsilon())) return;
+        mat.addScaledRow(target, source, factor);
+        if (recording) operations.push_back({RowOperation::Kind::AddScaled, target, source, factor});
+    }
+
+    // 最简形下把新主元行移到第 pos 行：相邻交换逐行下移，O(rows) 次指针交换
+    void moveRowUp(size_t from, size_t pos) {
+        for (size_t i = from; i > pos; i--) swapRows(i, i - 1);
+    }
+
+    // 日志涉及的最大行号 + 1；日志只能施加到至少这么多行的对象上
+    size_t requiredRows() const {
+        size_t n = 0;
+        for (const RowOperation& op : operations) n = std::max({n, op.target + 1, op.source + 1});
+        return n;
+    }
 
-    void toREF(T eps = static_cast<T>(1e-9)) {
+    void requireLog() const {
+        if (!recording) throw std::logic_error("Transform requires recordOperations() before reduction");
+    }
+
+    // 把日志施加到一列元素上
+    void replayOn(std::vector<T>& t) const {
+        for (const RowOperation& op : operations) {
+            switch (op.kind) {
+                case RowOperation::Kind::Swap: std::swap(t[op.target], t[op.source]); break;
+                case RowOperation::Kind::Scale: t[op.target] *= op.factor; break;
+                case RowOperation::Kind::AddScaled: t[op.target] += op.factor * t[op.source]; break;
+            }
+        }
+    }
+
+    // -------- Bareiss 无除法消元 (整数环) --------
+    // 每个中间元素都是原矩阵的某个子式，受 Hadamard 界约束；除法全部为整除
+    void fractionFreeREF() {
+        auto& a = mat.data;
         size_t rows = mat.getRows();
         size_t cols = mat.getCols();
         size_t pivotRow = 0;
-        rank = 0;
-        pivotCols.clear();
-        pivotRows.clear();
-
+        T prev = T(1);
         for (size_t col = 0; col < cols && pivotRow < rows; col++) {
-            size_t max_index = pivotRow;
-            T max_val = std::abs(mat.at(pivotRow, col));
-            for (size_t row = pivotRow + 1; row < rows; row++) {
-                T current_val = std::abs(mat.at(row, col));
-                if (current_val > max_val) {
-                    max_val = current_val;
-                    max_index = row;
+            size_t p = pivotRow;
+            while (p < rows && a[p][col] == T(0)) p++;
+            if (p == rows) continue;
+            if (p != pivotRow) std::swap(a[p], a[pivotRow]);
+
+            const std::vector<T>& pr = a[pivotRow];
+            const size_t grain = std::max<size_t>(1, (size_t(1) << 15) / (cols - col));
+            parallelFor(pivotRow + 1, rows, grain, [&](size_t lo, size_t hi) {
+                for (size_t row = lo; row < hi; row++) {
+                    std::vector<T>& r = a[row];
+                    for (size_t j = col + 1; j < cols; j++)
+                        r[j] = Matrix<T>::fractionFreeUpdate(r[j], pr[col], r[col], pr[j], prev);
+                    r[col] = T(0);
                 }
-            }
+            });
+            prev = pr[col];
+            rank++;
+            pivotCols.push_back(col);
+            pivotRows.push_back(pivotRow);
+            pivotRow++;
+        }
+        pivotScale = prev;
+    }
 
-            if (max_val < eps) continue;
+    // 在 Bareiss 阶梯形上按主元顺序向上消元 (fraction-free Gauss-Jordan)
+    // 结束后所有主元都等于 d，主元列为 d * e_k，即矩阵为 d * RREF(A)，元素仍为整数
+    void fractionFreeRREF() {
+        auto& a = mat.data;
+        size_t cols = mat.getCols();
+        T prev = T(1);
+        for (size_t k = 0; k < rank; k++) {
+            size_t row = pivotRows[k];
+            size_t col = pivotCols[k];
+            const std::vector<T>& pr = a[row];
+            const T p = pr[col];
+            parallelFor(0, row, std::max<size_t>(1, (size_t(1) << 15) / cols), [&](size_t lo, size_t hi) {
+                for (size_t upper = lo; upper < hi; upper++) {
+                    std::vector<T>& r = a[upper];
+                    const T factor = r[col];
+                    for (size_t j = 0; j < cols; j++) {
+                        if (j == col) continue;
+                        r[j] = Matrix<T>::fractionFreeUpdate(r[j], p, factor, pr[j], prev);
+                    }
+                    r[col] = T(0);
+                }
+            });
+            prev = p;
+        }
+    }
+
+    // -------- 分块消元 (右视，延迟更新) --------
+    // 每 panelWidth 列为一个面板：面板内逐列选主元消元，只更新面板内的列，乘子暂存在被消去的位置；
+    // 面板结束后对右侧尾部一次性施加 U12 = L11^{-1} A12 与 A22 += L21 U12 (乘子已含负号)，
+    // 把逐主元地把整个尾部读写一遍变成一次矩阵-矩阵乘积，瓶颈由内存带宽转为计算
+    static constexpr size_t panelWidth = 48;
+    static constexpr size_t blockedThreshold = 64 * 64;
+
+    template <typename Selector>
+    void eliminatePanel(size_t c0, size_t c1, size_t& pivotRow, T eps, Selector& selector) {
+        auto& a = mat.data;
+        const size_t rows = mat.getRows();
+        for (size_t col = c0; col < c1 && pivotRow < rows; col++) {
+            const size_t max_index = selector.selectRow(a, pivotRow, col);
+            if (ScalarTraits<T>::isZero(a[max_index][col], eps)) continue;
 
+            // 整行交换 (只交换行指针)，面板左侧的乘子与右侧尚未更新的尾部随行一起移动
             if (max_index != pivotRow) {
-                mat.exchangeRows(max_index, pivotRow);
+                swapRows(max_index, pivotRow);
+                selector.swapRows(max_index, pivotRow);
             }
 
             rank++;
             pivotCols.push_back(col);
             pivotRows.push_back(pivotRow);
 
+            const std::vector<T>& pr = a[pivotRow];
             for (size_t row = pivotRow + 1; row < rows; row++) {
-                if (std::abs(mat.at(row, col)) < eps) {
-                    mat.at(row, col) = 0;
+                std::vector<T>& r = a[row];
+                if (ScalarTraits<T>::isZero(r[col], eps)) {
+                    r[col] = T(0);
+                    continue;
+                }
+                T factor = -r[col] / pr[col];
+                // 与 Matrix::addScaledRow 一致：可忽略的系数不施加
+                if (ScalarTraits<T>::isZero(factor, ScalarTraits<T>::epsilon())) {
+                    r[col] = T(0);
                     continue;
                 }
-                T factor = -mat.at(row, col) / mat.at(pivotRow, col);
-                mat.addScaledRow(row, pivotRow, factor);
-                mat.at(row, col) = 0; 
+                for (size_t j = col + 1; j < c1; j++) r[j] += factor * pr[j];
+                r[col] = factor;
+                if (recording) operations.push_back({RowOperation::Kind::AddScaled, row, pivotRow, factor});
             }
             pivotRow++;
         }
+    }
+
+    // 把主元 firstPivot .. rank-1 的延迟更新施加到列 [c1, cols)，然后清除暂存的乘子
+    void updateTrailing(size_t firstPivot, size_t c1) {
+        auto& a = mat.data;
+        const size_t rows = mat.getRows();
+        const size_t cols = mat.getCols();
+        const size_t kp = rank - firstPivot;
+        if (kp == 0) return;
+        const size_t r0 = pivotRows[firstPivot];
+
+        if (c1 < cols) {
+            // U12：主元行之间的单位下三角回代，按主元顺序逐行完成
+            for (size_t k = 1; k < kp; k++) {
+                T* target = a[r0 + k].data();
+                for (size_t k2 = 0; k2 < k; k2++) {
+                    const T f = a[r0 + k][pivotCols[firstPivot + k2]];
+                    if (f == T(0)) continue;
+                    const T* src = a[r0 + k2].data();
+                    for (size_t j = c1; j < cols; j++) target[j] += f * src[j];
+                }
+            }
+
+            // A22 += L21 U12：按列分块使 kp 行 U12 的一块留在缓存中；
+            // 每次合并 4 个主元行，目标行的每个元素只读写一次。目标行之间互不依赖，按行块并行
+            constexpr size_t jBlock = 512;
+            const size_t grain = std::max<size_t>(1, (size_t(1) << 16) / (kp * (cols - c1)));
+            parallelFor(r0 + kp, rows, grain, [&](size_t lo, size_t hi) {
+                std::vector<T> f(kp);
+                for (size_t jj = c1; jj < cols; jj += jBlock) {
+                    const size_t jEnd = std::min(cols, jj + jBlock);
+                    for (size_t i = lo; i < hi; i++) {
+                        T* target = a[i].data();
+                        for (size_t k = 0; k < kp; k++) f[k] = target[pivotCols[firstPivot + k]];
+                        size_t k = 0;
+                        for (; k + 4 <= kp; k += 4) {
+                            const T f0 = f[k], f1 = f[k + 1], f2 = f[k + 2], f3 = f[k + 3];
+                            if (f0 == T(0) && f1 == T(0) && f2 == T(0) && f3 == T(0)) continue;
+                            const T* s0 = a[r0 + k].data();
+                            const T* s1 = a[r0 + k + 1].data();
+                            const T* s2 = a[r0 + k + 2].data();
+                            const T* s3 = a[r0 + k + 3].data();
+                            for (size_t j = jj; j < jEnd; j++)
+                                target[j] += f0 * s0[j] + f1 * s1[j] + f2 * s2[j] + f3 * s3[j];
+                        }
+                        for (; k < kp; k++) {
+                            if (f[k] == T(0)) continue;
+                            const T* src = a[r0 + k].data();
+                            for (size_t j = jj; j < jEnd; j++) target[j] += f[k] * src[j];
+                        }
+                    }
+                }
+            });
+        }
+
+        for (size_t k = 0; k < kp; k++) {
+            const size_t pc = pivotCols[firstPivot + k];
+            for (size_t i = r0 + k + 1; i < rows; i++) a[i][pc] = T(0);
+        }
+    }
+
+    // 用主元行 row 从 [from, to) 各行消去主元列 col，只更新 [firstCol, cols) 中 col 以外的列；
+    // 各目标行互不依赖，日志按行序串行写入后再按行块并行更新，每行更新完调用 after(r)
+    template <typename After>
+    void eliminateRows(size_t from, size_t to, size_t row, size_t col, size_t firstCol, T eps, After&& after) {
+        auto& a = mat.data;
+        const size_t cols = mat.getCols();
+        const T pivot = a[row][col];
+        if (recording) {
+            for (size_t r = from; r < to; r++) {
+                if (ScalarTraits<T>::isZero(a[r][col], eps)) continue;
+                const T factor = -a[r][col] / pivot;
+                if (ScalarTraits<T>::isZero(factor, ScalarTraits<T>::epsilon())) continue;
+                operations.push_back({RowOperation::Kind::AddScaled, r, row, factor});
+            }
+        }
+        const T* pr = a[row].data();
+        const size_t grain = std::max<size_t>(1, (size_t(1) << 15) / std::max<size_t>(1, cols - firstCol));
+        parallelFor(from, to, grain, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; i++) {
+                T* r = a[i].data();
+                if (!ScalarTraits<T>::isZero(r[col], eps)) {
+                    const T factor = -r[col] / pivot;
+                    if (!ScalarTraits<T>::isZero(factor, ScalarTraits<T>::epsilon())) {
+                        for (size_t j = firstCol; j < cols; j++)
+                            if (j != col) r[j] += factor * pr[j];
+                    }
+                }
+                r[col] = T(0);
+                after(i);
+            }
+        });
+    }
+
+    // 只选行的策略：按列面板分块消元 (见上)，矩阵较小时面板即整个矩阵，退化为逐列消元
+    template <typename Selector>
+    void rowPivotREF(Selector& selector, T eps) {
+        const size_t rows = mat.getRows();
+        const size_t cols = mat.getCols();
+        size_t pivotRow = 0;
+        const size_t width = rows * cols < blockedThreshold ? cols : panelWidth;
+        for (size_t c0 = 0; c0 < cols && pivotRow < rows; c0 += width) {
+            const size_t c1 = std::min(cols, c0 + width);
+            const size_t firstPivot = rank;
+            eliminatePanel(c0, c1, pivotRow, eps, selector);
+            updateTrailing(firstPivot, c1);
+        }
+    }
+
+    // 同时选列的策略：主元可落在任意未用列，第 k 个选出的主元位于第 k 行；
+    // 结果是列置换意义下的阶梯形 (主元行在主元列左侧不一定为零)，toREF 结束时把 (列, 行) 对按列号排序，
+    // toRREF 再化为按列序的唯一最简形 (canonicalizePivots)。
+    // 主元可忽略时：完全主元说明剩余子阵全可忽略，直接结束；rook 主元是所在列的最大者，只停用该列
+    void columnPivotREF(T eps) {
+        auto& a = mat.data;
+        const size_t rows = mat.getRows();
+        const size_t cols = mat.getCols();
+        std::vector<char> active(cols, 1);
+        size_t remaining = cols;
+        search.prepare(a, active);
+        size_t pivotRow = 0;
+        std::vector<size_t> skipped;
+        for (;;) {
+            while (pivotRow < rows && remaining > 0) {
+                size_t row, col;
+                search.selectPivot(a, pivotRow, active, row, col);
+                active[col] = 0;
+                remaining--;
+                if (ScalarTraits<T>::isZero(a[row][col], eps)) {
+                    if (Pivoting::searchesWholeBlock) break;
+                    skipped.push_back(col);
+                    continue;
+                }
+                if (row != pivotRow) {
+                    swapRows(row, pivotRow);
+                    search.swapRows(row, pivotRow);
+                }
+                rank++;
+                pivotCols.push_back(col);
+                pivotRows.push_back(pivotRow);
+                eliminateRows(pivotRow + 1, rows, pivotRow, col, 0, eps,
+                              [&](size_t r) { search.rowUpdated(a, r, active); });
+                pivotRow++;
+            }
+            // 被停用的列之后还会被其他主元行更新，可能重新变得不可忽略：重新启用这些列再扫一遍
+            // (每一轮至少新增一个主元)
+            if (Pivoting::searchesWholeBlock || pivotRow >= rows) break;
+            std::vector<size_t> stillSkipped;
+            for (size_t col : skipped) {
+                bool negligible = true;
+                for (size_t r = pivotRow; r < rows && negligible; r++)
+                    negligible = ScalarTraits<T>::isZero(a[r][col], eps);
+                if (negligible) {
+                    stillSkipped.push_back(col);
+                } else {
+                    active[col] = 1;
+                    remaining++;
+                }
+            }
+            if (remaining == 0) break;
+            skipped = std::move(stillSkipped);
+        }
+    }
+
+    // 主元行已化为主元 1：按主元行自下而上从上方各行消去主元列 (下方各行在前代时已消去)。
+    // 阶梯形下主元行在 col 左侧全为零、后续主元列已先被消去，只需更新 col 右侧
+    // 列主元策略的 (列, 行) 对按列号排序，行号不单调，因此按行号的逆序处理
+    void backSubstitute(T eps, bool echelon) {
+        std::vector<size_t> order(rank);
+        for (size_t i = 0; i < rank; i++) {
+            order[i] = i;
+            const size_t row = pivotRows[i];
+            scaleRow(row, T(1) / mat.at(row, pivotCols[i]));
+        }
+        if (!echelon)
+            std::sort(order.begin(), order.end(), [this](size_t x, size_t y) { return pivotRows[x] < pivotRows[y]; });
+        for (size_t i = rank; i > 0; i--) {
+            const size_t row = pivotRows[order[i - 1]];
+            const size_t col = pivotCols[order[i - 1]];
+            eliminateRows(0, row, row, col, echelon ? col + 1 : 0, eps, [](size_t) {});
+        }
+    }
+
+    // 列主元策略的 Gauss-Jordan 之后，前 rank 行的主元列恰为单位向量，每列就是它在所选主元列基下的坐标。
+    // 唯一最简形的主元列是字典序最前的一组无关列：按列序扫描，已确定的主元都在 j 左侧；
+    // 非主元列 j 在未确定的行上有非零坐标时与左侧无关，它与该行的主元交换 (取该列最大者，一次 O(rank * cols) 的消元)，
+    // 否则跳过。所选主元恰为字典序最前时不做任何消元，只检查 O(rank * cols) 个元素。最后按主元列排序各行
+    void canonicalizePivots(T eps) {
+        auto& a = mat.data;
+        const size_t cols = mat.getCols();
+        const size_t none = cols;
+        std::vector<size_t> colOfRow(rank), rowOfCol(cols, none);
+        for (size_t i = 0; i < rank; i++) {
+            colOfRow[pivotRows[i]] = pivotCols[i];
+            rowOfCol[pivotCols[i]] = pivotRows[i];
+        }
+        std::vector<char> fixed(rank, 0);
+        for (size_t j = 0; j < cols; j++) {
+            if (rowOfCol[j] != none) {
+                fixed[rowOfCol[j]] = 1;
+                continue;
+            }
+            size_t best = rank;
+            for (size_t k = 0; k < rank; k++) {
+                if (fixed[k] || ScalarTraits<T>::isZero(a[k][j], eps)) continue;
+                if (best == rank || ScalarTraits<T>::magnitude(a[k][j]) > ScalarTraits<T>::magnitude(a[best][j])) best = k;
+            }
+            if (best == rank) continue;
+            rowOfCol[colOfRow[best]] = none;
+            colOfRow[best] = j;
+            rowOfCol[j] = best;
+            fixed[best] = 1;
+            scaleRow(best, T(1) / a[best][j]);
+            eliminateRows(0, best, best, j, 0, eps, [](size_t) {});
+            eliminateRows(best + 1, rank, best, j, 0, eps, [](size_t) {});
+        }
+        for (size_t pos = 0; pos < rank; pos++) {
+            size_t m = pos;
+            for (size_t k = pos + 1; k < rank; k++)
+                if (colOfRow[k] < colOfRow[m]) m = k;
+            if (m != pos) {
+                swapRows(m, pos);
+                std::swap(colOfRow[m], colOfRow[pos]);
+            }
+        }
+        pivotCols = colOfRow;
+        for (size_t k = 0; k < rank; k++) pivotRows[k] = k;
+    }
+
+public:
+    RREF(const Matrix<T>& inputMat) : mat(inputMat), rank(0) {}
+
+    void toREF(T eps = ScalarTraits<T>::epsilon()) {
+        rank = 0;
+        pivotCols.clear();
+        pivotRows.clear();
+        if constexpr (ScalarTraits<T>::isIntegral) {
+            fractionFreeREF();
+            isREF = true;
+            return;
+        }
+
+        if constexpr (Pivoting::permutesColumns) {
+            columnPivotREF(eps);
+            // 对外按列号升序给出主元列，pivotRows[k] 为 pivotCols[k] 所在行
+            std::vector<size_t> order(rank);
+            for (size_t k = 0; k < rank; k++) order[k] = k;
+            std::sort(order.begin(), order.end(), [this](size_t x, size_t y) { return pivotCols[x] < pivotCols[y]; });
+            std::vector<size_t> cols(rank), rowsOf(rank);
+            for (size_t k = 0; k < rank; k++) {
+                cols[k] = pivotCols[order[k]];
+                rowsOf[k] = pivotRows[order[k]];
+            }
+            pivotCols = std::move(cols);
+            pivotRows = std::move(rowsOf);
+        } else {
+            search.prepare(mat.data);
+            rowPivotREF(search, eps);
+        }
         isREF = true;
     }
 
-    void toRREF(T eps = static_cast<T>(1e-9)) {
+    void toRREF(T eps = ScalarTraits<T>::epsilon()) {
         size_t rows = mat.getRows();
         size_t cols = mat.getCols();
         if (!isREF) toREF(eps);
-
-        for (size_t i = 0; i < rank; i++) {
-            size_t row = pivotRows[i];
-            size_t col = pivotCols[i];
-            T scaleFactor = static_cast<T>(1) / mat.at(row, col);
-            mat.scaleRow(row, scaleFactor);
+        if constexpr (ScalarTraits<T>::isIntegral) {
+            fractionFreeRREF();
+            isRREF = true;
+            return;
         }
 
-        for (size_t i = rank; i > 0; i--) {
-            size_t row = pivotRows[i - 1];
-            size_t col = pivotCols[i - 1];
-            for (size_t upperRow = row; upperRow > 0; upperRow--) {
-                size_t actualUpperRow = upperRow - 1;
-                if (std::abs(mat.at(actualUpperRow, col)) < eps) {
-                    mat.at(actualUpperRow, col) = 0;
-                    continue;
-                }
-                T factor = -mat.at(actualUpperRow, col);
-                mat.addScaledRow(actualUpperRow, row, factor);
-                mat.at(actualUpperRow, col) = 0;
+        if constexpr (Pivoting::permutesColumns) {
+            // 先相对所选主元列做 Gauss-Jordan，主元列化为单位向量；
+            // 再在已化简的前 rank 行上交换出字典序最前的主元列，不按部分主元重新消元
+            if (!isRREF) {
+                backSubstitute(eps, false);
+                canonicalizePivots(eps);
             }
+        } else {
+            backSubstitute(eps, true);
         }
 
         for (size_t i = 0; i < rows; i++) {
             for (size_t j = 0; j < cols; j++) {
-                if (std::abs(mat.at(i, j)) < eps) mat.at(i, j) = 0;
+                if (ScalarTraits<T>::isZero(mat.at(i, j), eps)) mat.at(i, j) = T(0);
             }
         }
         isRREF = true;
@@ -104,6 +650,8 @@ public:
     }
 
     size_t getRank() const noexcept { return rank; }
+    // getMatrix() 中主元的公共值 (整数类型为 d，其余类型为 1)
+    const T& getPivotScale() const noexcept { return pivotScale; }
     const Matrix<T>& getMatrix() const noexcept { return mat; }
     const std::vector<size_t>& getPivotCols() const noexcept { return pivotCols; }
     const std::vector<size_t>& getPivotRows() const noexcept { return pivotRows; }
@@ -115,9 +663,149 @@ public:
         pivotRows.clear();
         isREF = false;
         isRREF = false;
+        pivotScale = T(1);
+        operations.clear();
+    }
+
+    // -------- 增量更新 (不支持整数环的无除法路径) --------
+    // 开启行变换日志；须在 toREF / toRREF 之前调用，appendColumn 与 getTransform 依赖它
+    void recordOperations(bool enable = true) {
+        static_assert(!ScalarTraits<T>::isIntegral, "Incremental RREF requires a field type");
+        if (enable && isREF && !recording)
+            throw std::logic_error("Operation recording must be enabled before reduction");
+        recording = enable;
+    }
+
+    // -------- 变换记录 --------
+    // 日志从原矩阵起累计 (含 appendRow / appendColumn 产生的操作)，按顺序施加到行数相同的 M 上即得 E M。
+    // 每个操作 O(cols(M))，不形成 n x n 初等矩阵 (对比 Matrix::rowSwap / rowScale / rowadd)
+    const std::vector<RowOperation>& getOperations() const noexcept { return operations; }
+
+    void applyOperations(Matrix<T>& M) const {
+        requireLog();
+        if (M.rows < requiredRows()) throw std::invalid_argument("Matrix has fewer rows than the recorded operations");
+        auto& d = M.data;
+        for (const RowOperation& op : operations) {
+            switch (op.kind) {
+                case RowOperation::Kind::Swap: std::swap(d[op.target], d[op.source]); break;
+                case RowOperation::Kind::Scale:
+                    for (T& x : d[op.target]) x *= op.factor;
+                    break;
+                case RowOperation::Kind::AddScaled: {
+                    T* target = d[op.target].data();
+                    const T* source = d[op.source].data();
+                    for (size_t j = 0; j < M.cols; j++) target[j] += op.factor * source[j];
+                    break;
+                }
+            }
+        }
+    }
+
+    void applyOperations(Vector<T>& v) const {
+        requireLog();
+        if (v.size() < requiredRows()) throw std::invalid_argument("Vector is shorter than the recorded operations");
+        std::vector<T> t(v.raw());
+        replayOn(t);
+        v = Vector<T>(std::move(t));
+    }
+
+    // E (rows x rows) 满足 E A = getMatrix()，A 为原矩阵 (含追加的行列)：把日志重放到单位阵上
+    Matrix<T> getTransform() const {
+        Matrix<T> E = Matrix<T>::identity(static_cast<int>(mat.rows));
+        applyOperations(E);
+        return E;
+    }
+
+    // 行置换部分：getMatrix() 的第 i 行由原矩阵第 perm[i] 行经消元得到 (只看 Swap 操作)
+    std::vector<size_t> getRowPermutation() const {
+        requireLog();
+        std::vector<size_t> perm(mat.rows);
+        for (size_t i = 0; i < perm.size(); i++) perm[i] = i;
+        for (const RowOperation& op : operations)
+            if (op.kind == RowOperation::Kind::Swap) std::swap(perm[op.target], perm[op.source]);
+        return perm;
+    }
+
+    // 追加一行约束：先用已有主元行消去 (O(rank * cols))，仍非零则成为新主元行，
+    // 再从其余主元行中消去新主元列并按主元列顺序插入；线性相关时成为末尾的零行
+    void appendRow(const Vector<T>& row, T eps = ScalarTraits<T>::epsilon()) {
+        static_assert(!ScalarTraits<T>::isIntegral, "Incremental RREF requires a field type");
+        if (row.size() != mat.cols) throw std::invalid_argument("Row size must match matrix columns");
+        // 先化为最简形再追加：列主元策略的 toRREF 会在全部行上交换主元，
+        // 新行若已在矩阵中会被它消去一次、下面再消去一次
+        if (isREF && !isRREF) toRREF(eps);
+        mat.data.push_back(row.raw());
+        mat.rows++;
+        if (!isREF) return;  // 尚未消元：留给之后的 toREF / toRREF
+
+        const size_t r = mat.rows - 1;
+        std::vector<T>& a = mat.data[r];
+        for (size_t k = 0; k < rank; k++) {
+            const size_t pc = pivotCols[k];
+            if (!ScalarTraits<T>::isZero(a[pc], eps)) addScaledRow(r, pivotRows[k], -a[pc]);
+            a[pc] = T(0);
+        }
+
+        size_t c = mat.cols;
+        for (size_t j = 0; j < mat.cols; j++) {
+            if (ScalarTraits<T>::isZero(a[j], eps)) a[j] = T(0);
+            else if (c == mat.cols) c = j;
+        }
+        if (c == mat.cols) return;
+
+        scaleRow(r, T(1) / a[c]);
+        for (size_t k = 0; k < rank; k++) {
+            const size_t pr = pivotRows[k];
+            const T f = mat.data[pr][c];
+            if (!ScalarTraits<T>::isZero(f, eps)) addScaledRow(pr, r, -f);
+            mat.data[pr][c] = T(0);
+        }
+        const size_t pos = static_cast<size_t>(std::lower_bound(pivotCols.begin(), pivotCols.end(), c) - pivotCols.begin());
+        moveRowUp(r, pos);
+        pivotCols.insert(pivotCols.begin() + static_cast<std::ptrdiff_t>(pos), c);
+        pivotRows.push_back(rank);
+        rank++;
+    }
+
+    // 追加一列：按日志把新列变换到当前坐标系 (O(rows * rank) 次标量运算)，
+    // 零行部分出现非零元时它成为新的主元列 (下标最大，位于所有主元行之后)
+    void appendColumn(const Vector<T>& column, T eps = ScalarTraits<T>::epsilon()) {
+        static_assert(!ScalarTraits<T>::isIntegral, "Incremental RREF requires a field type");
+        const size_t rows = mat.rows;
+        if (column.size() != rows) throw std::invalid_argument("Column size must match matrix rows");
+        if (isREF && !recording)
+            throw std::logic_error("appendColumn on a reduced matrix requires recordOperations()");
+
+        // 同 appendRow：先化为最简形，再把 (含这一步的) 完整日志重放到新列上
+        if (isREF && !isRREF) toRREF(eps);
+        std::vector<T> t(column.raw());
+        if (isREF) replayOn(t);
+        const size_t c = mat.cols;
+        for (size_t i = 0; i < rows; i++) mat.data[i].push_back(ScalarTraits<T>::isZero(t[i], eps) ? T(0) : t[i]);
+        mat.cols++;
+        if (!isREF) return;
+
+        size_t p = rank;
+        for (size_t i = rank + 1; i < rows; i++) {
+            if (ScalarTraits<T>::magnitude(mat.data[i][c]) > ScalarTraits<T>::magnitude(mat.data[p][c])) p = i;
+        }
+        if (p >= rows || mat.data[p][c] == T(0)) return;
+
+        // 新主元行原是零行，除新列外全为零：消元只改动新列
+        swapRows(p, rank);
+        scaleRow(rank, T(1) / mat.data[rank][c]);
+        for (size_t i = 0; i < rows; i++) {
+            if (i == rank || mat.data[i][c] == T(0)) continue;
+            const T f = -mat.data[i][c];
+            if (recording) operations.push_back({RowOperation::Kind::AddScaled, i, rank, f});
+            mat.data[i][c] = T(0);
+        }
+        pivotCols.push_back(c);
+        pivotRows.push_back(rank);
+        rank++;
     }
 
-    std::vector<Vector<T>> getKernel(T eps = static_cast<T>(1e-9)) {
+    std::vector<Vector<T>> getKernel(T eps = ScalarTraits<T>::epsilon()) {
         if(!isRREF) toRREF(eps);
 
         size_t n = mat.getCols();
@@ -132,8 +820,9 @@ public:
             if(!isPivot) freeCols.push_back(j);
         }
         for (size_t freeCol : freeCols) {
-            std::vector<T> v_vec(n, 0);
-            v_vec[freeCol] = 1;
+            // 整数类型下基向量整体放大 d 倍以保持为整数向量
+            std::vector<T> v_vec(n, T(0));
+            v_vec[freeCol] = pivotScale;
             for (size_t i = 0; i < rank; i++) {
                 size_t pCol = pivotCols[i];
                 size_t pRow = pivotRows[i];
@@ -165,7 +854,7 @@ typename Matrix<T>::EigenDecomposition Matrix<T>::eigen(int max_iter) const {
     }
 
     EigenDecomposition result;
-    T eps = static_cast<T>(1e-9);
+    T eps = ScalarTraits<T>::epsilon();
 
     std::vector<T> all_lambdas;
     for(size_t i=0; i<rows; i++) all_lambdas.push_back(A_iter.at(i, i));
@@ -174,7 +863,7 @@ typename Matrix<T>::EigenDecomposition Matrix<T>::eigen(int max_iter) const {
     for (T lam : all_lambdas) {
         bool found = false;
         for (T ul : unique_lambdas) {
-            if (std::abs(lam - ul) < eps * 10) { 
+            if (ScalarTraits<T>::abs(lam - ul) < eps * 10) {
                 found = true;
                 break;
             }
@@ -225,5 +914,6 @@ typename Matrix<T>::DiagonalizationResult Matrix<T>::diagonalize() const {
             result.P.at(row, i) = eig.eigenvectors[i][row];
         }
     }
+    result.PInverse = isSymmetric() ? result.P.transpose() : result.P.getInverseMatrix();
     return result;
 }
\ No newline at end of file
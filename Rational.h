@@ -0,0 +1,144 @@
+// =========================================================
+// Rational.h — 精确有理数标量 (Layer 0)
+// ---------------------------------------------------------
+// 职责: 提供可直接代入 Matrix<T> / RREF<T> / SolvingEquation<T> 的精确标量
+// Rational<BigInt> (默认): 分子分母先走 int64 快速路径，溢出自动提升为大整数
+// Rational<long long>: 纯 int64，溢出时抛出 std::overflow_error
+// 不变量: den > 0 且 gcd(num, den) = 1，因此 == 就是精确相等
+// =========================================================
+#pragma once
+
+#include "ScalarTraits.h"
+#include "BigInt.h"
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+template <typename Int = BigInt>
+class Rational {
+private:
+    Int num;
+    Int den;
+
+    static Int gcdOf(const Int& a, const Int& b) {
+        if constexpr (std::is_integral_v<Int>) return std::gcd(a, b);
+        else return Int::gcd(a, b);
+    }
+
+    static Int mulChecked(const Int& a, const Int& b) {
+        if constexpr (std::is_integral_v<Int>) {
+            Int r;
+            if (__builtin_mul_overflow(a, b, &r)) throw std::overflow_error("Rational overflow (use Rational<BigInt>)");
+            return r;
+        } else {
+            return a * b;
+        }
+    }
+
+    static Int addChecked(const Int& a, const Int& b) {
+        if constexpr (std::is_integral_v<Int>) {
+            Int r;
+            if (__builtin_add_overflow(a, b, &r)) throw std::overflow_error("Rational overflow (use Rational<BigInt>)");
+            return r;
+        } else {
+            return a + b;
+        }
+    }
+
+    void normalize() {
+        if (den == Int(0)) throw std::domain_error("Rational with zero denominator");
+        if (den < Int(0)) {
+            num = -num;
+            den = -den;
+        }
+        Int g = gcdOf(num, den);
+        if (g != Int(1) && g != Int(0)) {
+            num /= g;
+            den /= g;
+        }
+    }
+
+    // 已约分的内部构造
+    struct Reduced {};
+    Rational(Int n, Int d, Reduced) : num(std::move(n)), den(std::move(d)) {}
+
+public:
+    Rational() : num(0), den(1) {}
+
+    template <typename I, typename = std::enable_if_t<std::is_integral_v<I>>>
+    Rational(I n) : num(static_cast<Int>(n)), den(1) {}
+
+    Rational(const Int& n) : num(n), den(1) {}
+
+    Rational(const Int& n, const Int& d) : num(n), den(d) { normalize(); }
+
+    const Int& numerator() const noexcept { return num; }
+    const Int& denominator() const noexcept { return den; }
+    bool isInteger() const { return den == Int(1); }
+
+    explicit operator long double() const {
+        return static_cast<long double>(num) / static_cast<long double>(den);
+    }
+    explicit operator double() const { return static_cast<double>(static_cast<long double>(*this)); }
+
+    // -------- 算术 --------
+    Rational operator-() const { return Rational(-num, den, Reduced{}); }
+
+    friend Rational operator+(const Rational& a, const Rational& b) {
+        if (a.den == b.den) return Rational(addChecked(a.num, b.num), a.den);
+        return Rational(addChecked(mulChecked(a.num, b.den), mulChecked(b.num, a.den)),
+                        mulChecked(a.den, b.den));
+    }
+
+    friend Rational operator-(const Rational& a, const Rational& b) { return a + (-b); }
+
+    // 先交叉约分再相乘，控制中间量的增长
+    friend Rational operator*(const Rational& a, const Rational& b) {
+        if (a.num == Int(0) || b.num == Int(0)) return Rational();
+        Int g1 = gcdOf(a.num, b.den);
+        Int g2 = gcdOf(b.num, a.den);
+        return Rational(mulChecked(a.num / g1, b.num / g2), mulChecked(a.den / g2, b.den / g1), Reduced{});
+    }
+
+    friend Rational operator/(const Rational& a, const Rational& b) {
+        if (b.num == Int(0)) throw std::domain_error("Rational division by zero");
+        Rational inv = (b.num < Int(0)) ? Rational(-b.den, -b.num, Reduced{}) : Rational(b.den, b.num, Reduced{});
+        return a * inv;
+    }
+
+    Rational& operator+=(const Rational& o) { return *this = *this + o; }
+    Rational& operator-=(const Rational& o) { return *this = *this - o; }
+    Rational& operator*=(const Rational& o) { return *this = *this * o; }
+    Rational& operator/=(const Rational& o) { return *this = *this / o; }
+
+    // -------- 比较 --------
+    friend bool operator==(const Rational& a, const Rational& b) { return a.num == b.num && a.den == b.den; }
+    friend bool operator!=(const Rational& a, const Rational& b) { return !(a == b); }
+    friend bool operator<(const Rational& a, const Rational& b) {
+        return mulChecked(a.num, b.den) < mulChecked(b.num, a.den);
+    }
+    friend bool operator>(const Rational& a, const Rational& b) { return b < a; }
+    friend bool operator<=(const Rational& a, const Rational& b) { return !(b < a); }
+    friend bool operator>=(const Rational& a, const Rational& b) { return !(a < b); }
+
+    friend std::ostream& operator<<(std::ostream& os, const Rational& r) {
+        if (r.den == Int(1)) return os << r.num;
+        // 先拼成字符串，使 std::setw 作用于整个 "p/q"
+        std::ostringstream ss;
+        ss << r.num << '/' << r.den;
+        return os << ss.str();
+    }
+};
+
+template <typename Int>
+struct ScalarTraits<Rational<Int>> {
+    using R = Rational<Int>;
+    static constexpr bool isExact = true;
+    static constexpr bool isIntegral = false;
+    static R epsilon() { return R(0); }
+    static R abs(const R& x) { return x < R(0) ? -x : x; }
+    static R magnitude(const R& x) { return abs(x); }
+    static bool isZero(const R& x, const R&) { return x == R(0); }
+};
@@ -0,0 +1,96 @@
+// =========================================================
+// ScalarTraits.h — 标量类型策略 (Layer 0, 无项目内依赖)
+// ---------------------------------------------------------
+// 职责: 把模板中散落的 "std::abs(x) < 1e-9" 判零、主元大小比较、
+//       默认容差统一收口到 ScalarTraits<T>
+// 浮点类型按容差判零；整数/有理数等精确类型按 x == 0 精确判零
+// 自定义标量 (Rational, BigInt ...) 在各自头文件中特化本模板
+// =========================================================
+#pragma once
+
+#include <cmath>
+#include <ostream>
+#include <type_traits>
+
+template <typename T>
+struct ScalarTraits {
+    static_assert(std::is_arithmetic_v<T>,
+                  "ScalarTraits: custom scalar types must specialize ScalarTraits");
+
+    // 精确类型：运算无舍入误差，判零不需要容差
+    static constexpr bool isExact = std::is_integral_v<T>;
+    // 整数环：除法会截断，消元需走无除法 (fraction-free) 路径
+    static constexpr bool isIntegral = std::is_integral_v<T>;
+
+    // 默认判零容差 (精确类型为 0)
+    static T epsilon() {
+        if constexpr (isExact) return T(0);
+        else return static_cast<T>(1e-9);
+    }
+
+    static T abs(const T& x) {
+        if constexpr (std::is_floating_point_v<T>) return std::abs(x);
+        else return x < T(0) ? T(-x) : x;
+    }
+
+    // 选主元时用来比较 "谁更大" 的量
+    static T magnitude(const T& x) { return abs(x); }
+
+    static bool isZero(const T& x, const T& eps) {
+        if constexpr (isExact) return x == T(0);
+        else return abs(x) < eps;
+    }
+
+    static T sqrt(const T& x) { return static_cast<T>(std::sqrt(x)); }
+
+    static T log(const T& x) { return static_cast<T>(std::log(x)); }
+};
+
+#ifdef __SIZEOF_FLOAT128__
+// __float128 (113 位尾数)：严格 C++ 模式下它不算 arithmetic 类型，std::abs / std::sqrt 等也没有重载，
+// 因此在这里显式特化；流输出运算符必须在 matrix.h 的模板定义之前声明 (内建类型没有 ADL)
+template <>
+struct ScalarTraits<__float128> {
+    using Q = __float128;
+    static constexpr bool isExact = false;
+    static constexpr bool isIntegral = false;
+    static Q epsilon() { return static_cast<Q>(1e-30); }  // 单位舍入约 1e-34
+    static Q abs(const Q& x) { return x < 0 ? -x : x; }
+    static Q magnitude(const Q& x) { return abs(x); }
+    static bool isZero(const Q& x, const Q& eps) { return abs(x) < eps; }
+
+    // long double 初值 + 两步 Newton (每步有效位翻倍)
+    static Q sqrt(const Q& x) {
+        if (!(x > 0)) return x == 0 ? Q(0) : static_cast<Q>(std::nan(""));
+        Q y = static_cast<Q>(std::sqrt(static_cast<long double>(x)));
+        for (int i = 0; i < 2; i++) y = (y + x / y) / 2;
+        return y;
+    }
+
+    // x = m * 2^k (m 在 [0.5, 1))，log x = log m + k ln2
+    // log m：long double 初值 + 一步 Newton y + m * exp(-y) - 1，
+    // exp 用 Taylor 级数求 exp(r) - 1，平方还原时按 (1 + s)^2 - 1 = s (s + 2) 保留低位
+    static Q log(const Q& x) {
+        if (!(x > 0)) return static_cast<Q>(x == 0 ? -HUGE_VAL : std::nan(""));
+        int k = 0;
+        std::frexp(static_cast<long double>(x), &k);
+        Q m = x;
+        for (int i = 0; i < (k < 0 ? -k : k); i++) m = k > 0 ? m / 2 : m * 2;
+        const Q ln2 = static_cast<Q>(6.931471805599452862e-01) + static_cast<Q>(2.319046813846299558e-17);
+
+        Q y = static_cast<Q>(std::log(static_cast<long double>(m)));
+        Q r = -y / 1024, term = r, s = r;
+        for (int i = 2; i <= 20; i++) {
+            term = term * r / i;
+            s += term;
+        }
+        for (int i = 0; i < 10; i++) s = s * (s + 2);
+        return (y + (m * s + (m - 1))) + ln2 * k;
+    }
+};
+
+// 按 long double 精度输出，保留 std::setw / std::setprecision 的格式控制
+inline std::ostream& operator<<(std::ostream& os, __float128 x) {
+    return os << static_cast<long double>(x);
+}
+#endif
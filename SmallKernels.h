@@ -0,0 +1,348 @@
+// =========================================================
+// SmallKernels.h — n <= 4 的闭式行列式与伴随矩阵 (Layer 0)
+// ---------------------------------------------------------
+// 职责: 给出 1x1 ~ 4x4 的余子式展开公式，无分支、无堆分配
+// 元素访问通过可调用对象 a(i, j) / out(i, j) 注入，
+// 同一份公式既用于 BatchedMatrix 的 SoA 批量循环，也可用于普通二维数组
+// 4x4 采用 2x2 子式配对 (Laplace 按前两行展开)：行列式 + 伴随共约 100 次乘法
+// 对称 2x2 / 3x3 特征分解：Jacobi 旋转 / 三角 (Cardano) 公式，近重根时退回 Jacobi 扫描
+// =========================================================
+#pragma once
+
+#include "ScalarTraits.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <type_traits>
+
+template <typename T>
+struct SmallKernels {
+    static constexpr size_t maxDim = 4;
+
+    // 运行期维数 n (1 ~ maxDim) 转成编译期常量：f(std::integral_constant<size_t, N>{})
+    // 其余 n (包括 0) 抛出 invalid_argument，调用方需先处理空矩阵
+    template <typename F>
+    static decltype(auto) dispatch(size_t n, F&& f) {
+        switch (n) {
+            case 1: return f(std::integral_constant<size_t, 1>{});
+            case 2: return f(std::integral_constant<size_t, 2>{});
+            case 3: return f(std::integral_constant<size_t, 3>{});
+            case 4: return f(std::integral_constant<size_t, 4>{});
+            default: throw std::invalid_argument("SmallKernels: dimension out of range");
+        }
+    }
+
+    // 闭式路径的奇异判定：精确类型 det == 0；
+    // 浮点按行缩放后的相对量 |det| <= eps * prod_i max_j |a_ij|，与部分主元 LU 的 "主元 < eps" 同量级，
+    // 且不会把整体缩小的良态矩阵 (如 1e-3 I) 误判为奇异
+    template <size_t N, typename A>
+    static bool isSingular(const T& det, const A& a, const T& eps) {
+        if (det == T(0)) return true;
+        if constexpr (ScalarTraits<T>::isExact) {
+            return false;
+        } else {
+            T scale = T(1);
+            for (size_t i = 0; i < N; i++) {
+                T rowMax = T(0);
+                for (size_t j = 0; j < N; j++) rowMax = std::max(rowMax, ScalarTraits<T>::abs(a(i, j)));
+                scale *= rowMax;
+            }
+            return ScalarTraits<T>::isZero(det, eps * scale);
+        }
+    }
+
+    template <size_t N, typename A>
+    static T determinant(const A& a) {
+        static_assert(N >= 1 && N <= maxDim, "SmallKernels: closed form only for n <= 4");
+        if constexpr (N == 1) {
+            return a(0, 0);
+        } else if constexpr (N == 2) {
+            return a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0);
+        } else if constexpr (N == 3) {
+            return a(0, 0) * (a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1))
+                 - a(0, 1) * (a(1, 0) * a(2, 2) - a(1, 2) * a(2, 0))
+                 + a(0, 2) * (a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0));
+        } else {
+            T s0 = a(0, 0) * a(1, 1) - a(1, 0) * a(0, 1);
+            T s1 = a(0, 0) * a(1, 2) - a(1, 0) * a(0, 2);
+            T s2 = a(0, 0) * a(1, 3) - a(1, 0) * a(0, 3);
+            T s3 = a(0, 1) * a(1, 2) - a(1, 1) * a(0, 2);
+            T s4 = a(0, 1) * a(1, 3) - a(1, 1) * a(0, 3);
+            T s5 = a(0, 2) * a(1, 3) - a(1, 2) * a(0, 3);
+            T c5 = a(2, 2) * a(3, 3) - a(3, 2) * a(2, 3);
+            T c4 = a(2, 1) * a(3, 3) - a(3, 1) * a(2, 3);
+            T c3 = a(2, 1) * a(3, 2) - a(3, 1) * a(2, 2);
+            T c2 = a(2, 0) * a(3, 3) - a(3, 0) * a(2, 3);
+            T c1 = a(2, 0) * a(3, 2) - a(3, 0) * a(2, 2);
+            T c0 = a(2, 0) * a(3, 1) - a(3, 0) * a(2, 1);
+            return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        }
+    }
+
+    // 写出伴随矩阵 adj(A) (A^{-1} = adj(A) / det)，返回 det
+    template <size_t N, typename A, typename Out>
+    static T adjugate(const A& a, Out&& out) {
+        static_assert(N >= 1 && N <= maxDim, "SmallKernels: closed form only for n <= 4");
+        if constexpr (N == 1) {
+            out(0, 0) = T(1);
+            return a(0, 0);
+        } else if constexpr (N == 2) {
+            T a00 = a(0, 0), a01 = a(0, 1), a10 = a(1, 0), a11 = a(1, 1);
+            out(0, 0) = a11;  out(0, 1) = -a01;
+            out(1, 0) = -a10; out(1, 1) = a00;
+            return a00 * a11 - a01 * a10;
+        } else if constexpr (N == 3) {
+            T a00 = a(0, 0), a01 = a(0, 1), a02 = a(0, 2);
+            T a10 = a(1, 0), a11 = a(1, 1), a12 = a(1, 2);
+            T a20 = a(2, 0), a21 = a(2, 1), a22 = a(2, 2);
+            T b00 = a11 * a22 - a12 * a21;
+            T b10 = a12 * a20 - a10 * a22;
+            T b20 = a10 * a21 - a11 * a20;
+            out(0, 0) = b00; out(0, 1) = a02 * a21 - a01 * a22; out(0, 2) = a01 * a12 - a02 * a11;
+            out(1, 0) = b10; out(1, 1) = a00 * a22 - a02 * a20; out(1, 2) = a02 * a10 - a00 * a12;
+            out(2, 0) = b20; out(2, 1) = a01 * a20 - a00 * a21; out(2, 2) = a00 * a11 - a01 * a10;
+            return a00 * b00 + a01 * b10 + a02 * b20;
+        } else {
+            T a00 = a(0, 0), a01 = a(0, 1), a02 = a(0, 2), a03 = a(0, 3);
+            T a10 = a(1, 0), a11 = a(1, 1), a12 = a(1, 2), a13 = a(1, 3);
+            T a20 = a(2, 0), a21 = a(2, 1), a22 = a(2, 2), a23 = a(2, 3);
+            T a30 = a(3, 0), a31 = a(3, 1), a32 = a(3, 2), a33 = a(3, 3);
+            T s0 = a00 * a11 - a10 * a01;
+            T s1 = a00 * a12 - a10 * a02;
+            T s2 = a00 * a13 - a10 * a03;
+            T s3 = a01 * a12 - a11 * a02;
+            T s4 = a01 * a13 - a11 * a03;
+            T s5 = a02 * a13 - a12 * a03;
+            T c5 = a22 * a33 - a32 * a23;
+            T c4 = a21 * a33 - a31 * a23;
+            T c3 = a21 * a32 - a31 * a22;
+            T c2 = a20 * a33 - a30 * a23;
+            T c1 = a20 * a32 - a30 * a22;
+            T c0 = a20 * a31 - a30 * a21;
+            out(0, 0) = a11 * c5 - a12 * c4 + a13 * c3;
+            out(0, 1) = -a01 * c5 + a02 * c4 - a03 * c3;
+            out(0, 2) = a31 * s5 - a32 * s4 + a33 * s3;
+            out(0, 3) = -a21 * s5 + a22 * s4 - a23 * s3;
+            out(1, 0) = -a10 * c5 + a12 * c2 - a13 * c1;
+            out(1, 1) = a00 * c5 - a02 * c2 + a03 * c1;
+            out(1, 2) = -a30 * s5 + a32 * s2 - a33 * s1;
+            out(1, 3) = a20 * s5 - a22 * s2 + a23 * s1;
+            out(2, 0) = a10 * c4 - a11 * c2 + a13 * c0;
+            out(2, 1) = -a00 * c4 + a01 * c2 - a03 * c0;
+            out(2, 2) = a30 * s4 - a31 * s2 + a33 * s0;
+            out(2, 3) = -a20 * s4 + a21 * s2 - a23 * s0;
+            out(3, 0) = -a10 * c3 + a11 * c1 - a12 * c0;
+            out(3, 1) = a00 * c3 - a01 * c1 + a02 * c0;
+            out(3, 2) = -a30 * s3 + a31 * s1 - a32 * s0;
+            out(3, 3) = a20 * s3 - a21 * s1 + a22 * s0;
+            return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        }
+    }
+
+    // -------- 对称特征分解 (仅浮点) --------
+    // 输出 w 升序，V 的第 c 列是 w[c] 对应的单位特征向量
+
+    // 2x2：一次 Jacobi 旋转消去非对角元 (只用 sqrt，不调用三角函数)，任何输入都稳定
+    template <typename A>
+    static void symmetricEigen2(const A& a, T w[2], T V[2][2]) {
+        T cs, sn, l0, l1;
+        rotate2(a(0, 0), a(0, 1), a(1, 1), cs, sn, l0, l1);
+        const bool swap = l1 < l0;
+        w[0] = swap ? l1 : l0;
+        w[1] = swap ? l0 : l1;
+        V[0][0] = swap ? sn : cs; V[1][0] = swap ? cs : -sn;
+        V[0][1] = swap ? cs : sn; V[1][1] = swap ? -sn : cs;
+    }
+
+    // 3x3：三角公式求出最大、最小特征值，取离另外两个更远的那个 λf，
+    // 其特征向量由 A - λf I 两行的叉积给出 (取模最大的一对)；
+    // 再把 A 投影到该向量的正交补上，剩下的 2x2 用 Givens 旋转求解 (重根也稳定)
+    // 全程无分支 (只用条件选择)，便于跨批量向量化
+    // 返回 false 表示三个特征值几乎相同 (谱宽 <= sqrt(machine eps) * 量级)，调用方应改用 jacobiEigen
+    template <typename A>
+    static bool symmetricEigen3(const A& a, T w[3], T V[3][3]) {
+        const T a00 = a(0, 0), a01 = a(0, 1), a02 = a(0, 2);
+        const T a11 = a(1, 1), a12 = a(1, 2), a22 = a(2, 2);
+        const T q = (a00 + a11 + a22) / 3;
+        const T b00 = a00 - q, b11 = a11 - q, b22 = a22 - q;
+        const T p1 = a01 * a01 + a02 * a02 + a12 * a12;
+        const T p = std::sqrt((b00 * b00 + b11 * b11 + b22 * b22 + 2 * p1) / 6);
+        const T detB = b00 * (b11 * b22 - a12 * a12) - a01 * (a01 * b22 - a12 * a02) + a02 * (a01 * a12 - b11 * a02);
+        const T pp = p > 0 ? p : T(1);
+        T r = detB / (2 * pp * pp * pp);
+        r = r < -1 ? T(-1) : (r > 1 ? T(1) : r);
+        const T phi = std::acos(r) / 3;
+        const T cphi = std::cos(phi);
+        const T sphi = std::sqrt(std::max(T(0), 1 - cphi * cphi));  // phi 在 [0, π/3]
+        const T lMax = q + 2 * p * cphi;
+        const T lMin = q - p * (cphi + T(1.7320508075688772935) * sphi);  // 2p cos(phi + 2π/3)
+        const T lMid = 3 * q - lMax - lMin;
+        const T magnitude = std::max(std::abs(lMax), std::abs(lMin));
+        const bool ok = (lMax - lMin) > std::sqrt(std::numeric_limits<T>::epsilon()) * magnitude;
+
+        // 离群特征值的特征向量
+        const T lf = (lMax - lMid) >= (lMid - lMin) ? lMax : lMin;
+        const T r0[3] = {a00 - lf, a01, a02};
+        const T r1[3] = {a01, a11 - lf, a12};
+        const T r2[3] = {a02, a12, a22 - lf};
+        T c01[3], c02[3], c12[3];
+        cross(r0, r1, c01);
+        cross(r0, r2, c02);
+        cross(r1, r2, c12);
+        const T d01 = dot3(c01, c01), d02 = dot3(c02, c02), d12 = dot3(c12, c12);
+        T v[3], dMax = d01;
+        for (int i = 0; i < 3; i++) v[i] = c01[i];
+        const bool use02 = d02 > dMax;
+        for (int i = 0; i < 3; i++) v[i] = use02 ? c02[i] : v[i];
+        dMax = use02 ? d02 : dMax;
+        const bool use12 = d12 > dMax;
+        for (int i = 0; i < 3; i++) v[i] = use12 ? c12[i] : v[i];
+        dMax = use12 ? d12 : dMax;
+        const T invLen = T(1) / std::sqrt(dMax > 0 ? dMax : T(1));
+        for (int i = 0; i < 3; i++) v[i] *= invLen;
+
+        // 正交补的一组标准正交基 u, t
+        const bool xBig = std::abs(v[0]) > std::abs(v[1]);
+        const T nu = T(1) / std::sqrt(xBig ? v[0] * v[0] + v[2] * v[2] : v[1] * v[1] + v[2] * v[2]);
+        const T u[3] = {xBig ? -v[2] * nu : T(0), xBig ? T(0) : v[2] * nu, xBig ? v[0] * nu : -v[1] * nu};
+        T t[3];
+        cross(v, u, t);
+
+        // 投影后的 2x2：M = [u t]^T A [u t]
+        T Au[3], At[3], Av[3];
+        mul3(a00, a01, a02, a11, a12, a22, u, Au);
+        mul3(a00, a01, a02, a11, a12, a22, t, At);
+        mul3(a00, a01, a02, a11, a12, a22, v, Av);
+        const T m00 = dot3(u, Au), m01 = dot3(t, Au), m11 = dot3(t, At);
+        T cs, sn, mu0, mu1;
+        rotate2(m00, m01, m11, cs, sn, mu0, mu1);
+
+        T lam[3] = {dot3(v, Av), mu0, mu1};
+        T vec[3][3];
+        for (int i = 0; i < 3; i++) {
+            vec[0][i] = v[i];
+            vec[1][i] = cs * u[i] - sn * t[i];
+            vec[2][i] = sn * u[i] + cs * t[i];
+        }
+
+        // 三元素排序网络 (条件交换)
+        auto order = [&](int x, int y) {
+            const bool s = lam[y] < lam[x];
+            const T lx = lam[x], ly = lam[y];
+            lam[x] = s ? ly : lx;
+            lam[y] = s ? lx : ly;
+            for (int i = 0; i < 3; i++) {
+                const T vx = vec[x][i], vy = vec[y][i];
+                vec[x][i] = s ? vy : vx;
+                vec[y][i] = s ? vx : vy;
+            }
+        };
+        order(0, 1);
+        order(1, 2);
+        order(0, 1);
+        for (int c = 0; c < 3; c++) {
+            w[c] = lam[c];
+            for (int i = 0; i < 3; i++) V[i][c] = vec[c][i];
+        }
+        return ok;
+    }
+
+    // 循环 Jacobi：逐个消去非对角元，二次收敛，对重根与近重根都可靠
+    // 运行期维数 n，a、V 为 n x n 行主序连续存储并直接按下标访问；a 会被改写 (对角线收敛为特征值)，
+    // V 为旋转的累积 (第 c 列对应 a(c, c))。jacobiEigen 与 Kronecker 因子的对称对角化共用
+    static void jacobiRotate(T* a, T* V, size_t n) {
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++) V[i * n + j] = T(i == j ? 1 : 0);
+
+        T unit = T(1e-30);
+        if constexpr (std::numeric_limits<T>::is_specialized) unit = std::numeric_limits<T>::epsilon();
+        T total = T(0);
+        for (size_t i = 0; i < n * n; i++) total += a[i] * a[i];
+        const T tiny = unit * unit * total;
+
+        for (int sweep = 0; sweep < 100; sweep++) {
+            T off = T(0);
+            for (size_t i = 0; i < n; i++)
+                for (size_t j = i + 1; j < n; j++) off += a[i * n + j] * a[i * n + j];
+            if (off <= tiny) break;
+
+            for (size_t p = 0; p < n; p++) {
+                for (size_t q = p + 1; q < n; q++) {
+                    const T apq = a[p * n + q];
+                    if (apq == T(0)) continue;
+                    const T theta = (a[q * n + q] - a[p * n + p]) / (2 * apq);
+                    const T tn = (theta >= T(0) ? T(1) : T(-1)) /
+                                 (ScalarTraits<T>::abs(theta) + ScalarTraits<T>::sqrt(theta * theta + T(1)));
+                    const T c = T(1) / ScalarTraits<T>::sqrt(tn * tn + T(1));
+                    const T s = tn * c;
+                    for (size_t k = 0; k < n; k++) {
+                        T* row = a + k * n;
+                        const T akp = row[p], akq = row[q];
+                        row[p] = c * akp - s * akq;
+                        row[q] = s * akp + c * akq;
+                    }
+                    T* rp = a + p * n;
+                    T* rq = a + q * n;
+                    for (size_t k = 0; k < n; k++) {
+                        const T apk = rp[k], aqk = rq[k];
+                        rp[k] = c * apk - s * aqk;
+                        rq[k] = s * apk + c * aqk;
+                    }
+                    for (size_t k = 0; k < n; k++) {
+                        T* row = V + k * n;
+                        const T vkp = row[p], vkq = row[q];
+                        row[p] = c * vkp - s * vkq;
+                        row[q] = s * vkp + c * vkq;
+                    }
+                }
+            }
+        }
+    }
+
+    // N 阶定长版本，特征值升序
+    template <size_t N>
+    static void jacobiEigen(T a[N][N], T w[N], T V[N][N]) {
+        jacobiRotate(&a[0][0], &V[0][0], N);
+
+        // 按特征值升序排列 (选择排序，N 很小)
+        for (size_t i = 0; i < N; i++) w[i] = a[i][i];
+        for (size_t i = 0; i < N; i++) {
+            size_t m = i;
+            for (size_t j = i + 1; j < N; j++) if (w[j] < w[m]) m = j;
+            if (m == i) continue;
+            std::swap(w[i], w[m]);
+            for (size_t k = 0; k < N; k++) std::swap(V[k][i], V[k][m]);
+        }
+    }
+
+private:
+    // 对称 2x2 [[a, b], [b, c]] 的 Jacobi 旋转：l0 对应 (cs, -sn)，l1 对应 (sn, cs)
+    static void rotate2(T a, T b, T c, T& cs, T& sn, T& l0, T& l1) {
+        const bool nonzero = b != T(0);
+        const T theta = (c - a) / (2 * (nonzero ? b : T(1)));
+        T tn = (theta >= 0 ? T(1) : T(-1)) / (std::abs(theta) + std::sqrt(theta * theta + 1));
+        tn = nonzero ? tn : T(0);
+        cs = T(1) / std::sqrt(tn * tn + 1);
+        sn = tn * cs;
+        l0 = a - tn * b;
+        l1 = c + tn * b;
+    }
+
+    static T dot3(const T x[3], const T y[3]) { return x[0] * y[0] + x[1] * y[1] + x[2] * y[2]; }
+
+    static void cross(const T x[3], const T y[3], T out[3]) {
+        out[0] = x[1] * y[2] - x[2] * y[1];
+        out[1] = x[2] * y[0] - x[0] * y[2];
+        out[2] = x[0] * y[1] - x[1] * y[0];
+    }
+
+    // 对称矩阵 (上三角给出) 乘向量
+    static void mul3(T a00, T a01, T a02, T a11, T a12, T a22, const T x[3], T out[3]) {
+        out[0] = a00 * x[0] + a01 * x[1] + a02 * x[2];
+        out[1] = a01 * x[0] + a11 * x[1] + a12 * x[2];
+        out[2] = a02 * x[0] + a12 * x[1] + a22 * x[2];
+    }
+};
@@ -3,7 +3,11 @@
 #include<iostream>
 #include<vector>
 #include<cmath>
+#include<limits>
 #include<stdexcept>
+#include<type_traits>
+#include<algorithm>
+#include<optional>
 
 template <typename T>
 class SolvingEquation
@@ -14,23 +18,168 @@ class SolvingEquation
         UniqueSolution,
         InfiniteSolutions
     };
+        enum class SolveMethod {
+            Elimination,     // 默认：RREF 判定解的类型并给出通解
+            MixedPrecision   // 方阵：float 下 LU 分解 + T 精度迭代精化，奇异时退回 Elimination
+        };
     private:
-        Matrix<T> augmented;
+        Matrix<T> augmented;           // 仅在走 RREF 时构造，n <= 4 的闭式路径不分配
         Matrix<T> rrefMatrix;
-        RREF<T> rrefSolver;
+        std::optional<RREF<T>> rrefSolver;
         SolutionType type;
+        SolveMethod method;
+        bool solvedDirectly = false;   // 已由闭式 Cramer / LU / 迭代精化直接得到唯一解
+        bool refined = false;          // MixedPrecision：float 分解 + 迭代精化收敛 (未退回 T 精度 LU)
         
         Vector<T> particular;//特解
         std::vector<Vector<T>> nullspace;//齐次解空间的基
+
+        // 混合精度迭代精化：float 分解的吞吐约为 double 的两倍、访存减半
+        // 残差用 long double 累加，后向误差降到 T 的机器精度量级即停止
+        // 修正量不再收缩 (停滞)、或 A / b 超出 float 范围时退回 T 精度 LU；T 精度下也奇异则返回 false
+        // 奇异判定相对矩阵尺度：主元 |u_kk| <= n u max(主元所在原始行的 max|a_ij|, U 第 k 行的 max|u_kj|)
+        // 视为 (数值) 奇异，后者同时覆盖主元增长；按行取尺度，行缩放差异大的非奇异矩阵不会被误判
+        // 秩亏但相容的方程组残差也很小，不能靠后向误差区分，须交回 RREF 判定
+        bool solveMixedPrecision(const Matrix<T>& A, const Matrix<T>& b) {
+            if constexpr (!std::is_floating_point_v<T> || std::is_same_v<T, float>) {
+                return false;
+            } else {
+                const size_t n = A.getRows();
+                const int maxIter = 30;
+                const T unitRoundoff = std::numeric_limits<T>::epsilon();
+                const T normA = A.normInf();
+                const Vector<T> rhs = b.getCol(0);
+                const T normB = rhs.normInf();
+                std::vector<T> rowScale(n, T(0));
+                for (size_t i = 0; i < n; i++)
+                    for (size_t j = 0; j < n; j++) rowScale[i] = std::max(rowScale[i], std::abs(A.at(i, j)));
+                // 分解中途的主元阈值取最小行尺度 (低于它的主元必然不合格)，其余交给分解后的逐行检查
+                // luDecomposition 的阈值相对 max|a_ij|，这里传入最小 / 最大行尺度之比
+                const T maxRowScale = n == 0 ? T(0) : *std::max_element(rowScale.begin(), rowScale.end());
+                const T minRowScale = n == 0 ? T(0) : *std::min_element(rowScale.begin(), rowScale.end());
+                const T rowScaleRatio = maxRowScale > T(0) ? minRowScale / maxRowScale : T(0);
+
+                auto wellConditioned = [&](const auto& lu, auto u) {
+                    using S = decltype(u);
+                    std::vector<size_t> orig(n);
+                    for (size_t i = 0; i < n; i++) orig[i] = i;
+                    for (size_t k = 0; k < n; k++) std::swap(orig[k], orig[lu.perm[k]]);
+                    for (size_t k = 0; k < n; k++) {
+                        S scale = static_cast<S>(rowScale[orig[k]]);
+                        for (size_t j = k; j < n; j++) scale = std::max(scale, std::abs(lu.LU.at(k, j)));
+                        if (!std::isfinite(scale) || !(std::abs(lu.LU.at(k, k)) > static_cast<S>(n) * u * scale))
+                            return false;
+                    }
+                    return true;
+                };
+
+                auto residual = [&](const Vector<T>& x) {
+                    std::vector<T> r(n);
+                    for (size_t i = 0; i < n; i++) {
+                        long double acc = static_cast<long double>(rhs[i]);
+                        for (size_t j = 0; j < n; j++)
+                            acc -= static_cast<long double>(A.at(i, j)) * static_cast<long double>(x[j]);
+                        r[i] = static_cast<T>(acc);
+                    }
+                    return Vector<T>(std::move(r));
+                };
+
+                auto allFinite = [](const Vector<T>& v) {
+                    return std::all_of(v.raw().begin(), v.raw().end(), [](const T& e) { return std::isfinite(e); });
+                };
+
+                // 元素超出 float 范围时 float 分解只会得到 inf / NaN
+                const T floatMax = static_cast<T>(std::numeric_limits<float>::max());
+                bool converged = false;
+                Vector<T> x(n, T(0));
+                if (normA <= floatMax && normB <= floatMax) {
+                    try {
+                        const float floatRoundoff = std::numeric_limits<float>::epsilon();
+                        auto lowLU = A.template cast<float>().luDecomposition(
+                            static_cast<float>(n) * floatRoundoff * static_cast<float>(rowScaleRatio));
+                        if (!wellConditioned(lowLU, floatRoundoff))
+                            throw std::invalid_argument("Matrix is ill-conditioned in float");
+                        x = lowLU.solve(rhs.template cast<float>()).template cast<T>();
+                        T lastStep = std::numeric_limits<T>::infinity();
+                        for (int iter = 0; iter < maxIter; iter++) {
+                            Vector<T> r = residual(x);
+                            T backwardError = r.normInf() / (normA * x.normInf() + normB);
+                            if (std::isfinite(backwardError) && backwardError <= unitRoundoff && allFinite(x)) {
+                                converged = true;
+                                break;
+                            }
+                            Vector<T> d = lowLU.solve(r.template cast<float>()).template cast<T>();
+                            T step = d.normInf();
+                            if (!(step < lastStep / 2)) break;  // 停滞或发散
+                            x += d;
+                            lastStep = step;
+                        }
+                    } catch (const std::invalid_argument&) {
+                        // float 下奇异或病态，直接走 T 精度分解
+                    }
+                }
+
+                refined = converged;
+                if (!converged) {
+                    try {
+                        auto fullLU = A.luDecomposition(static_cast<T>(n) * unitRoundoff * rowScaleRatio);
+                        if (!wellConditioned(fullLU, unitRoundoff)) return false;
+                        x = fullLU.solve(rhs);
+                    } catch (const std::invalid_argument&) {
+                        return false;
+                    }
+                }
+                particular = std::move(x);
+                return true;
+            }
+        }
+        // n <= 4 的方阵：Cramer 法则 x = adj(A) b / det，不做消元
+        // 奇异 (或整数类型，需保留无除法路径) 时返回 false，交给 RREF 判定无解 / 无穷多解
+        bool solveClosedForm(const Matrix<T>& A, const Matrix<T>& b) {
+            if constexpr (ScalarTraits<T>::isIntegral) {
+                return false;
+            } else {
+                auto a = [&A](size_t i, size_t j) -> const T& { return A.at(i, j); };
+                return SmallKernels<T>::dispatch(A.getRows(), [&](auto dim) {
+                    constexpr size_t N = decltype(dim)::value;
+                    T adj[N][N];
+                    auto out = [&adj](size_t i, size_t j) -> T& { return adj[i][j]; };
+                    T det = SmallKernels<T>::template adjugate<N>(a, out);
+                    if (SmallKernels<T>::template isSingular<N>(det, a, ScalarTraits<T>::epsilon())) return false;
+                    particular = Vector<T>(N, T(0));
+                    for (size_t i = 0; i < N; i++) {
+                        T& xi = particular[i];
+                        for (size_t j = 0; j < N; j++) xi += adj[i][j] * b.at(j, 0);
+                        xi /= det;
+                    }
+                    return true;
+                });
+            }
+        }
     public:
-        SolvingEquation(const Matrix<T>& A, const Matrix<T>& b)
-    : rrefSolver(A.augment(b)), augmented(A.augment(b))
+        SolvingEquation(const Matrix<T>& A, const Matrix<T>& b,
+                        SolveMethod solveMethod = SolveMethod::Elimination)
+    : method(solveMethod)
     {
         if (b.getRows() != A.getRows() || b.getCols() != 1)
             throw std::invalid_argument("Invalid dimensions");
 
-        rrefSolver.toRREF();
-        rrefMatrix = rrefSolver.getMatrix();
+        if (A.isSquare() && A.getRows() >= 1 && A.getRows() <= SmallKernels<T>::maxDim && solveClosedForm(A, b)) {
+            solvedDirectly = true;
+            type = SolutionType::UniqueSolution;
+            return;
+        }
+
+        if (method == SolveMethod::MixedPrecision && A.isSquare() && solveMixedPrecision(A, b)) {
+            solvedDirectly = true;
+            type = SolutionType::UniqueSolution;
+            return;
+        }
+
+        augmented = A.augment(b);
+        rrefSolver.emplace(augmented);
+        rrefSolver->toRREF();
+        rrefMatrix = rrefSolver->getMatrix();
         type = solve();  // 立即求解
     }
 
@@ -38,8 +187,9 @@ class SolvingEquation
 
         SolutionType solve()
         {
+            if (solvedDirectly) return type;
             size_t n = augmented.getCols() - 1;
-            const auto& pivotCols = rrefSolver.getPivotCols();
+            const auto& pivotCols = rrefSolver->getPivotCols();
             // 无解判断: 增广列（最后一列）是否有主元
             for(size_t col : pivotCols)
             {
@@ -56,8 +206,9 @@ class SolvingEquation
             return type;
         }
 
-        void computeSolution(T eps = static_cast<T>(1e-9)) 
+        void computeSolution(T eps = ScalarTraits<T>::epsilon()) 
         {
+            if (solvedDirectly) return;
             if (type == SolutionType::NoSolution)
                 solve();
             
@@ -65,12 +216,24 @@ class SolvingEquation
                 throw std::logic_error("No solution exists");
 
             size_t n = augmented.getCols() - 1;
-            const auto& pivotCols = rrefSolver.getPivotCols();
+            const auto& pivotCols = rrefSolver->getPivotCols();
             
+            // 整数类型的化简矩阵为 d * RREF，特解需除回 d (须整除)，零空间基整体放大 d 倍
+            const T scale = rrefSolver->getPivotScale();
+            auto unscale = [&](const T& x) {
+                if constexpr (ScalarTraits<T>::isIntegral) {
+                    if (!(x % scale == T(0)))
+                        throw std::domain_error("Particular solution is not integral (use Rational)");
+                    return T(x / scale);
+                } else {
+                    return x;
+                }
+            };
+
             if (type == SolutionType::UniqueSolution) {
                 std::vector<T> part_vec(n);
                 for (size_t i = 0; i < n; i++)
-                    part_vec[i] = rrefMatrix.at(i, n);
+                    part_vec[i] = unscale(rrefMatrix.at(i, n));
                 particular = Vector<T>(std::move(part_vec));
             } else {
                 std::vector<size_t> freeCols;
@@ -80,17 +243,17 @@ class SolvingEquation
                     if (!isPivot) freeCols.push_back(j);
                 }
                 
-                std::vector<T> part_vec(n, 0);
+                std::vector<T> part_vec(n, T(0));
                 for (size_t i = 0; i < pivotCols.size(); i++) {
                     size_t col = pivotCols[i];
-                    part_vec[col] = rrefMatrix.at(i, n);
+                    part_vec[col] = unscale(rrefMatrix.at(i, n));
                 }
                 particular = Vector<T>(std::move(part_vec));
 
                 nullspace.clear();
                 for (auto freeCol : freeCols) {
-                    std::vector<T> v_vec(n, 0);
-                    v_vec[freeCol] = 1;
+                    std::vector<T> v_vec(n, T(0));
+                    v_vec[freeCol] = scale;
                     for (size_t i = 0; i < pivotCols.size(); i++) {
                         size_t pcol = pivotCols[i];
                         v_vec[pcol] = -rrefMatrix.at(i, freeCol);
@@ -100,6 +263,11 @@ class SolvingEquation
             }
         }
 
+        SolutionType getSolutionType() const noexcept { return type; }
+        bool isRefined() const noexcept { return refined; }
+        const Vector<T>& getParticularSolution() const noexcept { return particular; }
+        const std::vector<Vector<T>>& getNullspaceBasis() const noexcept { return nullspace; }
+
         void printSolution() const {
             size_t n = particular.size();
             if (type == SolutionType::NoSolution) {
@@ -0,0 +1,451 @@
+// =========================================================
+// SparseRREF.h — 稀疏矩阵与 Markowitz 主元消元 (Layer 2)
+// ---------------------------------------------------------
+// 职责: 每行只存非零元 (按列号有序)，消元时按 Markowitz 代价 (r_i - 1)(c_j - 1) 选主元限制填充，
+//       接口与 RREF<T> 对齐: toREF / getRank / getPivotCols / getKernel
+// 适用: 每行只有少量非零元的大规模约束矩阵 (10^5 阶)，稠密 RREF<T> 存不下
+// 实现: 行表 + 列计数；列到行的索引惰性维护 (填充时追加，用到时再剔除已失效的项)；
+//       主元只在非零元最少的几列 / 几行中搜索 (Zlatev 限定搜索)，浮点类型另加阈值条件
+//       |a_ij| >= u * max_k |a_kj| 保证数值稳定
+// 零空间: 不做向上消元 (会引入大量填充)，而是对每个自由列在上三角因子上做稀疏回代，
+//       只访问从该列可达的主元；结果与 RREF<T>::getKernel 同构：
+//       自由列 f 置 1、其余自由列为 0，按自由列升序排列
+// 整数环请用 RREF<T> (Bareiss) 或 Rational；GF(2) 请用 BitMatrix.h
+// =========================================================
+#pragma once
+
+#include "matrix.h"
+#include <vector>
+#include <set>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+template <typename T>
+class SparseMatrix {
+public:
+    struct Entry {
+        size_t col;
+        T value;
+    };
+
+private:
+    size_t rows = 0;
+    size_t cols = 0;
+    std::vector<std::vector<Entry>> data;  // 每行按列号升序，不存零
+
+    template <typename U>
+    friend class SparseRREF;
+
+public:
+    SparseMatrix() = default;
+
+    SparseMatrix(size_t r, size_t c) : rows(r), cols(c), data(r) {
+        if (r == 0 || c == 0) throw std::invalid_argument("Matrix dimensions must be positive");
+    }
+
+    explicit SparseMatrix(const Matrix<T>& m) : SparseMatrix(m.getRows(), m.getCols()) {
+        for (size_t i = 0; i < rows; i++)
+            for (size_t j = 0; j < cols; j++)
+                if (!(m.at(i, j) == T(0))) data[i].push_back({j, m.at(i, j)});
+    }
+
+    size_t getRows() const noexcept { return rows; }
+    size_t getCols() const noexcept { return cols; }
+
+    size_t nonZeros() const noexcept {
+        size_t total = 0;
+        for (const auto& r : data) total += r.size();
+        return total;
+    }
+
+    const std::vector<Entry>& row(size_t r) const {
+        if (r >= rows) throw std::out_of_range("Row index out of bounds");
+        return data[r];
+    }
+
+    T at(size_t r, size_t c) const {
+        if (r >= rows || c >= cols) throw std::out_of_range("Matrix index out of bounds");
+        auto it = std::lower_bound(data[r].begin(), data[r].end(), c,
+                                   [](const Entry& e, size_t col) { return e.col < col; });
+        return it != data[r].end() && it->col == c ? it->value : T(0);
+    }
+
+    // a(r, c) += value；按行顺序、列号递增插入时为 O(1)
+    void add(size_t r, size_t c, const T& value) {
+        if (r >= rows || c >= cols) throw std::out_of_range("Matrix index out of bounds");
+        std::vector<Entry>& row = data[r];
+        auto it = row.empty() || row.back().col < c
+                      ? row.end()
+                      : std::lower_bound(row.begin(), row.end(), c, [](const Entry& e, size_t col) { return e.col < col; });
+        if (it != row.end() && it->col == c) {
+            it->value += value;
+            if (it->value == T(0)) row.erase(it);
+        } else if (!(value == T(0))) {
+            row.insert(it, {c, value});
+        }
+    }
+
+    Vector<T> operator*(const Vector<T>& x) const {
+        if (x.size() != cols) throw std::invalid_argument("Matrix columns must match vector size for multiplication");
+        std::vector<T> y(rows, T(0));
+        for (size_t i = 0; i < rows; i++)
+            for (const Entry& e : data[i]) y[i] += e.value * x[e.col];
+        return Vector<T>(std::move(y));
+    }
+
+    // 仅供调试与小规模校验
+    Matrix<T> toMatrix() const {
+        Matrix<T> m(rows, cols);
+        for (size_t i = 0; i < rows; i++)
+            for (const Entry& e : data[i]) m.at(i, e.col) = e.value;
+        return m;
+    }
+
+    Vector<T> getRowVector(size_t r) const {
+        std::vector<T> v(cols, T(0));
+        for (const Entry& e : row(r)) v[e.col] = e.value;
+        return Vector<T>(std::move(v));
+    }
+};
+
+template <typename T>
+class SparseRREF {
+private:
+    static_assert(!ScalarTraits<T>::isIntegral, "SparseRREF requires a field type");
+    using Entry = typename SparseMatrix<T>::Entry;
+    using Mag = decltype(ScalarTraits<T>::magnitude(std::declval<T>()));
+
+    SparseMatrix<T> mat;            // 消元后主元行冻结为上三角因子 U 的行
+    T eps;
+    Mag threshold;                  // 阈值主元参数 u (0, 1]，越大越稳定、填充越多
+    size_t searchLimit;             // 每步最多检查的列数与行数
+
+    size_t rank = 0;
+    std::vector<size_t> stepRows;   // 第 k 个主元所在的 (原) 行
+    std::vector<size_t> stepCols;   // 第 k 个主元列
+    std::vector<size_t> pivotCols;  // 主元列升序
+    std::vector<size_t> pivotRows;  // 与 pivotCols 对应的原行号
+    bool isREF = false;
+
+    // -------- 消元期间的活动结构 --------
+    std::vector<std::vector<size_t>> colRows;         // 列 -> 可能含非零元的活动行 (可含失效 / 重复项)
+    std::vector<size_t> colCount;                     // 列在活动行中的非零元个数
+    std::vector<char> rowActive;
+    std::vector<char> colActive;
+    std::set<std::pair<size_t, size_t>> colQueue;     // (非零元个数, 列)，只含个数 > 0 的活动列
+    std::set<std::pair<size_t, size_t>> rowQueue;     // (非零元个数, 行)，只含非空的活动行
+    std::vector<size_t> queuedColCount;               // colQueue 中该列当前的键，npos 表示不在队列
+    std::vector<size_t> dirtyCols;
+    std::vector<size_t> rowStamp;                     // activeColumn 去重用的时间戳
+    std::vector<size_t> colStamp;                     // dirtyCols 去重用的时间戳
+    size_t epoch = 0;
+
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    static const Entry* find(const std::vector<Entry>& row, size_t c) {
+        auto it = std::lower_bound(row.begin(), row.end(), c, [](const Entry& e, size_t col) { return e.col < col; });
+        return it != row.end() && it->col == c ? &*it : nullptr;
+    }
+
+    void touchCol(size_t c) {
+        if (colStamp[c] != epoch) {
+            colStamp[c] = epoch;
+            dirtyCols.push_back(c);
+        }
+    }
+
+    // 把本步计数变化过的列同步到 colQueue；个数降为 0 的列不会再出现填充，永久成为自由列
+    void flushCols() {
+        for (size_t c : dirtyCols) {
+            if (!colActive[c]) continue;
+            if (queuedColCount[c] != npos) colQueue.erase({queuedColCount[c], c});
+            queuedColCount[c] = colCount[c] > 0 ? colCount[c] : npos;
+            if (colCount[c] > 0) colQueue.insert({colCount[c], c});
+        }
+        dirtyCols.clear();
+    }
+
+    void requeueRow(size_t r, size_t oldSize) {
+        if (oldSize > 0) rowQueue.erase({oldSize, r});
+        if (!mat.data[r].empty()) rowQueue.insert({mat.data[r].size(), r});
+    }
+
+    // 列 c 在活动行中的非零元 (行, 值)；顺带剔除 colRows[c] 中的失效与重复项
+    std::vector<std::pair<size_t, T>> activeColumn(size_t c) {
+        std::vector<std::pair<size_t, T>> result;
+        std::vector<size_t>& list = colRows[c];
+        epoch++;
+        size_t kept = 0;
+        for (size_t r : list) {
+            if (!rowActive[r] || rowStamp[r] == epoch) continue;
+            const Entry* e = find(mat.data[r], c);
+            if (e == nullptr) continue;
+            rowStamp[r] = epoch;
+            list[kept++] = r;
+            result.push_back({r, e->value});
+        }
+        list.resize(kept);
+        return result;
+    }
+
+    // 限定搜索的 Markowitz 主元：先查非零元最少的几列，代价不为零时再查非零元最少的几行
+    bool selectPivot(size_t& pivotRow, size_t& pivotCol) {
+        size_t bestCost = npos;
+        Mag bestMag = Mag(0);
+        auto consider = [&](size_t r, size_t c, const T& v, const Mag& colMax) {
+            const Mag m = ScalarTraits<T>::magnitude(v);
+            if constexpr (!ScalarTraits<T>::isExact) {
+                if (m < colMax * threshold) return;
+            }
+            const size_t cost = (mat.data[r].size() - 1) * (colCount[c] - 1);
+            if (cost < bestCost || (cost == bestCost && m > bestMag)) {
+                bestCost = cost;
+                bestMag = m;
+                pivotRow = r;
+                pivotCol = c;
+            }
+        };
+        auto columnMax = [](const std::vector<std::pair<size_t, T>>& column) {
+            Mag colMax = Mag(0);
+            for (const auto& rv : column) colMax = std::max(colMax, ScalarTraits<T>::magnitude(rv.second));
+            return colMax;
+        };
+
+        size_t examined = 0;
+        for (auto it = colQueue.begin(); it != colQueue.end() && examined < searchLimit; ++examined) {
+            const size_t c = (it++)->second;
+            const auto column = activeColumn(c);
+            const Mag colMax = columnMax(column);
+            for (const auto& rv : column) consider(rv.first, c, rv.second, colMax);
+            if (bestCost == 0) return true;
+        }
+        examined = 0;
+        for (auto it = rowQueue.begin(); it != rowQueue.end() && examined < searchLimit; ++it, ++examined) {
+            const size_t r = it->second;
+            for (const Entry& e : mat.data[r]) {
+                if (bestCost == 0) return true;
+                consider(r, e.col, e.value, columnMax(activeColumn(e.col)));
+            }
+        }
+        return bestCost != npos;
+    }
+
+    // row r += factor * 主元行 p，结果中去掉主元列 c；有序合并，填充与抵消同步到列计数
+    void eliminateRow(size_t r, size_t p, size_t c, const T& factor, std::vector<Entry>& merged) {
+        const std::vector<Entry>& pr = mat.data[p];
+        std::vector<Entry>& row = mat.data[r];
+        const size_t oldSize = row.size();
+        merged.clear();
+        size_t i = 0, j = 0;
+        while (i < row.size() || j < pr.size()) {
+            if (j == pr.size() || (i < row.size() && row[i].col < pr[j].col)) {
+                merged.push_back(row[i++]);
+            } else if (i == row.size() || pr[j].col < row[i].col) {
+                const size_t col = pr[j].col;
+                const T v = factor * pr[j++].value;
+                if (col == c || ScalarTraits<T>::isZero(v, eps)) continue;
+                merged.push_back({col, v});
+                colCount[col]++;
+                colRows[col].push_back(r);
+                touchCol(col);
+            } else {
+                const size_t col = row[i].col;
+                const T v = row[i++].value + factor * pr[j++].value;
+                if (col == c) continue;
+                if (ScalarTraits<T>::isZero(v, eps)) {
+                    colCount[col]--;
+                    touchCol(col);
+                } else {
+                    merged.push_back({col, v});
+                }
+            }
+        }
+        row.swap(merged);
+        requeueRow(r, oldSize);
+    }
+
+    void eliminate() {
+        const size_t rows = mat.rows;
+        const size_t cols = mat.cols;
+        colRows.assign(cols, {});
+        colCount.assign(cols, 0);
+        rowActive.assign(rows, 1);
+        colActive.assign(cols, 1);
+        queuedColCount.assign(cols, npos);
+        rowStamp.assign(rows, 0);
+        colStamp.assign(cols, 0);
+        epoch = 0;
+        colQueue.clear();
+        rowQueue.clear();
+        dirtyCols.clear();
+
+        for (size_t r = 0; r < rows; r++) {
+            std::vector<Entry>& row = mat.data[r];
+            row.erase(std::remove_if(row.begin(), row.end(),
+                                     [this](const Entry& e) { return ScalarTraits<T>::isZero(e.value, eps); }),
+                      row.end());
+            for (const Entry& e : row) {
+                colCount[e.col]++;
+                colRows[e.col].push_back(r);
+            }
+            if (!row.empty()) rowQueue.insert({row.size(), r});
+        }
+        for (size_t c = 0; c < cols; c++) {
+            if (colCount[c] > 0) {
+                colQueue.insert({colCount[c], c});
+                queuedColCount[c] = colCount[c];
+            }
+        }
+
+        std::vector<Entry> merged;
+        size_t p, c;
+        while (!colQueue.empty() && selectPivot(p, c)) {
+            const auto column = activeColumn(c);
+            const T pivot = find(mat.data[p], c)->value;
+
+            // 主元行退出活动集：其余列的计数减一，主元列整体退出
+            rowActive[p] = 0;
+            rowQueue.erase({mat.data[p].size(), p});
+            colActive[c] = 0;
+            colQueue.erase({queuedColCount[c], c});
+            epoch++;
+            for (const Entry& e : mat.data[p]) {
+                if (e.col == c) continue;
+                colCount[e.col]--;
+                touchCol(e.col);
+            }
+
+            for (const auto& rv : column) {
+                if (rv.first == p) continue;
+                eliminateRow(rv.first, p, c, -rv.second / pivot, merged);
+            }
+            flushCols();
+            colRows[c].clear();
+            colRows[c].shrink_to_fit();
+
+            stepRows.push_back(p);
+            stepCols.push_back(c);
+            rank++;
+        }
+        colRows.clear();
+        colRows.shrink_to_fit();
+        colQueue.clear();
+        rowQueue.clear();
+
+        std::vector<size_t> order(rank);
+        for (size_t k = 0; k < rank; k++) order[k] = k;
+        std::sort(order.begin(), order.end(), [this](size_t a, size_t b) { return stepCols[a] < stepCols[b]; });
+        for (size_t k : order) {
+            pivotCols.push_back(stepCols[k]);
+            pivotRows.push_back(stepRows[k]);
+        }
+    }
+
+    // 精确类型不做阈值检查 (也无法从 double 构造)
+    static Mag thresholdFrom(double u) {
+        if constexpr (ScalarTraits<T>::isExact) return Mag(1);
+        else return static_cast<Mag>(u);
+    }
+
+public:
+    // u 为阈值主元参数：u = 1 即部分主元，较小的 u 给 Markowitz 更多选择、填充更少
+    explicit SparseRREF(const SparseMatrix<T>& inputMat, T tol = ScalarTraits<T>::epsilon(),
+                        double u = 0.1, size_t search = 4)
+        : mat(inputMat), eps(tol), threshold(thresholdFrom(u)), searchLimit(std::max<size_t>(1, search)) {
+        if (!(u > 0.0 && u <= 1.0)) throw std::invalid_argument("Pivot threshold must be in (0, 1]");
+    }
+
+    void toREF() {
+        if (isREF) return;
+        rank = 0;
+        stepRows.clear();
+        stepCols.clear();
+        pivotCols.clear();
+        pivotRows.clear();
+        eliminate();
+        isREF = true;
+    }
+
+    size_t getRank() {
+        toREF();
+        return rank;
+    }
+
+    // 主元列 (升序) 与对应主元所在的原矩阵行号：这些行是一组极大线性无关的约束
+    const std::vector<size_t>& getPivotCols() {
+        toREF();
+        return pivotCols;
+    }
+
+    const std::vector<size_t>& getPivotRows() {
+        toREF();
+        return pivotRows;
+    }
+
+    // 零空间的基：第 t 行是第 t 个自由列 f 对应的基向量 (x_f = 1，其余自由列为 0)。
+    // 主元列由回代得到：x_{c_k} = -(Σ_{j ≠ c_k} u_kj x_j) / u_{k c_k}，按消元步骤逆序求解；
+    // 从 f 出发沿 "列 -> 含该列的主元行 -> 其主元列" 搜索可达的步骤，只对它们回代
+    SparseMatrix<T> getKernel() {
+        toREF();
+        const size_t n = mat.cols;
+        std::vector<char> isPivot(n, 0);
+        for (size_t c : pivotCols) isPivot[c] = 1;
+        std::vector<size_t> freeCols;
+        for (size_t j = 0; j < n; j++)
+            if (!isPivot[j]) freeCols.push_back(j);
+        if (freeCols.empty()) return SparseMatrix<T>();
+
+        // 列 j -> 在非主元位置含 j 的步骤 k
+        std::vector<size_t> stepOfCol(n, npos);
+        for (size_t k = 0; k < rank; k++) stepOfCol[stepCols[k]] = k;
+        std::vector<std::vector<size_t>> users(n);
+        for (size_t k = 0; k < rank; k++)
+            for (const Entry& e : mat.data[stepRows[k]])
+                if (e.col != stepCols[k]) users[e.col].push_back(k);
+
+        SparseMatrix<T> basis(freeCols.size(), n);
+        std::vector<T> x(n, T(0));
+        std::vector<size_t> visited(rank, npos);
+        std::vector<size_t> reach, stack;
+        for (size_t t = 0; t < freeCols.size(); t++) {
+            const size_t f = freeCols[t];
+            reach.clear();
+            stack.assign(1, f);
+            while (!stack.empty()) {
+                const size_t col = stack.back();
+                stack.pop_back();
+                for (size_t k : users[col]) {
+                    if (visited[k] == t) continue;
+                    visited[k] = t;
+                    reach.push_back(k);
+                    stack.push_back(stepCols[k]);
+                }
+            }
+            // x_{c_k} 只依赖更晚消去的主元列与自由列：按步骤逆序回代
+            std::sort(reach.begin(), reach.end(), std::greater<size_t>());
+            x[f] = T(1);
+            for (size_t k : reach) {
+                T sum = T(0);
+                T diag = T(1);
+                for (const Entry& e : mat.data[stepRows[k]]) {
+                    if (e.col == stepCols[k]) diag = e.value;
+                    else if (!(x[e.col] == T(0))) sum += e.value * x[e.col];
+                }
+                x[stepCols[k]] = -sum / diag;
+            }
+
+            std::vector<Entry>& out = basis.data[t];
+            out.push_back({f, T(1)});
+            for (size_t k : reach) {
+                const size_t col = stepCols[k];
+                if (!ScalarTraits<T>::isZero(x[col], eps)) out.push_back({col, x[col]});
+                x[col] = T(0);
+            }
+            x[f] = T(0);
+            std::sort(out.begin(), out.end(), [](const Entry& a, const Entry& b) { return a.col < b.col; });
+        }
+        return basis;
+    }
+};
@@ -0,0 +1,150 @@
+// =========================================================
+// Subspaces.h — 四个基本子空间 (Layer 3, 应用层)
+// ---------------------------------------------------------
+// 职责: 一次消元同时给出 A (m x n) 的列空间、行空间、零空间与左零空间的基
+// 实现: 只消元 A 一次并记录行变换日志 (recordOperations)，E A = RREF(A)；
+//       E 的后 m - r 行 y 满足 y A = 0，即左零空间的基。
+//       这些行只在 "主元行的原行号" 与自身原行号上非零，按日志在 m x (r + 1) 的压缩形式上重放，
+//       O(m r^2)，不再对 [A | I_m] 消元 (O(m^2 (n + m)))
+//       取代 getKernel + VectorSet(列空间，再消元一次) + 转置再消元 (左零空间) 的三次 O(n^3)
+// 存储: 基向量按子空间的自然方向连续存放在 Matrix 中
+//       columnSpace m x r、nullSpace n x (n - r) 以列为基；rowSpace r x n、leftNullSpace (m - r) x m 以行为基；
+//       维数为 0 的子空间返回 0 x 0 矩阵
+// 整数类型走 Bareiss：行空间与左零空间为 d 倍的整数行，零空间基整体放大 d 倍 (与 RREF::getKernel 一致)
+//       Bareiss 不记录日志，左零空间仍由 [A | I_m] 的右侧 I 部分给出
+// =========================================================
+#pragma once
+
+#include "matrix.h"
+#include "RREF.h"
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+
+template <typename T, typename Pivoting = PartialPivoting>
+class Subspaces {
+private:
+    size_t m;
+    size_t n;
+    size_t rank = 0;
+    std::vector<size_t> pivotCols;
+    Matrix<T> columnBasis;
+    Matrix<T> rowBasis;
+    Matrix<T> nullBasis;
+    Matrix<T> leftNullBasis;
+
+    // Matrix 不允许零维：空子空间用默认构造的 0 x 0 矩阵表示
+    static Matrix<T> basis(size_t rows, size_t cols) {
+        return rows == 0 || cols == 0 ? Matrix<T>() : Matrix<T>(rows, cols);
+    }
+
+    // 按日志重放 E 的行：第 i 行 = self[i] e_{origin[i]} + Σ_k coef[i][k] e_{perm[k]}，perm[k] 为第 k 个主元行的原行号
+    // 加到别的行上的总是主元行，其支撑落在 {perm[k]} 中，故每行只需 r + 1 个数
+    void leftNullFromLog(const RREF<T, Pivoting>& solver) {
+        const std::vector<size_t> perm = solver.getRowPermutation();
+        std::vector<size_t> slot(m, rank);
+        for (size_t k = 0; k < rank; k++) slot[perm[k]] = k;
+
+        std::vector<size_t> origin(m);
+        std::vector<T> self(m, T(1));
+        std::vector<T> coef(m * rank, T(0));
+        for (size_t i = 0; i < m; i++) origin[i] = i;
+
+        using Op = typename RREF<T, Pivoting>::RowOperation;
+        for (const Op& op : solver.getOperations()) {
+            T* t = coef.data() + op.target * rank;
+            switch (op.kind) {
+                case Op::Kind::Swap:
+                    std::swap(origin[op.target], origin[op.source]);
+                    std::swap(self[op.target], self[op.source]);
+                    std::swap_ranges(t, t + rank, coef.data() + op.source * rank);
+                    break;
+                case Op::Kind::Scale:
+                    self[op.target] *= op.factor;
+                    for (size_t k = 0; k < rank; k++) t[k] *= op.factor;
+                    break;
+                case Op::Kind::AddScaled: {
+                    const T* src = coef.data() + op.source * rank;
+                    for (size_t k = 0; k < rank; k++) t[k] += op.factor * src[k];
+                    if (self[op.source] == T(0)) break;
+                    const size_t k = slot[origin[op.source]];
+                    if (k == rank) {
+                        // 非主元行作为源：压缩形式不成立，退回完整的 E
+                        const Matrix<T> E = solver.getTransform();
+                        for (size_t i = rank; i < m; i++)
+                            for (size_t j = 0; j < m; j++) leftNullBasis.at(i - rank, j) = E.at(i, j);
+                        return;
+                    }
+                    t[k] += op.factor * self[op.source];
+                    break;
+                }
+            }
+        }
+
+        for (size_t i = rank; i < m; i++) {
+            leftNullBasis.at(i - rank, origin[i]) += self[i];
+            for (size_t k = 0; k < rank; k++) leftNullBasis.at(i - rank, perm[k]) += coef[i * rank + k];
+        }
+    }
+
+public:
+    explicit Subspaces(const Matrix<T>& A, T eps = ScalarTraits<T>::epsilon())
+        : m(A.getRows()), n(A.getCols()) {
+        if (m == 0 || n == 0) throw std::invalid_argument("Matrix cannot be empty");
+        RREF<T, Pivoting> solver(ScalarTraits<T>::isIntegral ? A.augment(Matrix<T>::identity(static_cast<int>(m))) : A);
+        if constexpr (!ScalarTraits<T>::isIntegral) solver.recordOperations();
+        solver.toRREF(eps);
+        const Matrix<T>& R = solver.getMatrix();
+        const T scale = solver.getPivotScale();
+
+        // 最简形的主元列按列序排列，落在 A 部分的即 A 的主元列，对应主元行为 0 .. r-1
+        for (size_t c : solver.getPivotCols()) {
+            if (c >= n) break;
+            pivotCols.push_back(c);
+        }
+        rank = pivotCols.size();
+
+        columnBasis = basis(m, rank);
+        for (size_t i = 0; i < m; i++)
+            for (size_t k = 0; k < rank; k++) columnBasis.at(i, k) = A.at(i, pivotCols[k]);
+
+        rowBasis = basis(rank, n);
+        for (size_t k = 0; k < rank; k++)
+            for (size_t j = 0; j < n; j++) rowBasis.at(k, j) = R.at(k, j);
+
+        // 自由列 f：x_f = d，x_{p_k} = -R(k, f)
+        nullBasis = basis(n, n - rank);
+        size_t k = 0, f = 0;
+        for (size_t j = 0; j < n; j++) {
+            if (k < rank && pivotCols[k] == j) {
+                k++;
+                continue;
+            }
+            nullBasis.at(j, f) = scale;
+            for (size_t p = 0; p < rank; p++) nullBasis.at(pivotCols[p], f) = -R.at(p, j);
+            f++;
+        }
+
+        leftNullBasis = basis(m - rank, m);
+        if (rank == m) return;
+        if constexpr (ScalarTraits<T>::isIntegral) {
+            for (size_t i = rank; i < m; i++)
+                for (size_t j = 0; j < m; j++) leftNullBasis.at(i - rank, j) = R.at(i, n + j);
+        } else {
+            leftNullFromLog(solver);
+        }
+    }
+
+    size_t getRank() const noexcept { return rank; }
+    size_t nullity() const noexcept { return n - rank; }
+    const std::vector<size_t>& getPivotCols() const noexcept { return pivotCols; }
+
+    // A 的主元列 (原矩阵中的列，而非最简形中的单位列)
+    const Matrix<T>& columnSpace() const noexcept { return columnBasis; }
+    // RREF(A) 的非零行
+    const Matrix<T>& rowSpace() const noexcept { return rowBasis; }
+    // A N = 0
+    const Matrix<T>& nullSpace() const noexcept { return nullBasis; }
+    // L A = 0
+    const Matrix<T>& leftNullSpace() const noexcept { return leftNullBasis; }
+};
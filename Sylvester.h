@@ -0,0 +1,149 @@
+// =========================================================
+// Sylvester.h — Sylvester / Lyapunov 矩阵方程 (Layer 3, 应用层)
+// ---------------------------------------------------------
+// 职责: 解 A X + X B = C 与 A X + X A^T = Q，不展开成 n^2 x n^2 的线性方程组
+// 实现: Bartels-Stewart。A = U R U^T、B = V S V^T 取实 Schur 分解 (Matrix::realSchur)，
+//       方程化为 R Y + Y S = U^T C V，R、S 拟上三角，按对角块回代，X = U Y V^T
+// 代价: 两次 Schur 分解 O(n^3) 只做一次，之后每个右端项 O(n^2 m + n m^2)
+// 可解性: A 与 -B 没有公共特征值；否则对角块方程奇异，抛出 domain_error
+// =========================================================
+#pragma once
+
+#include "matrix.h"
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+
+template <typename T>
+class SylvesterSolver {
+private:
+    typename Matrix<T>::SchurDecomposition schurA;
+    typename Matrix<T>::SchurDecomposition schurB;
+    std::vector<size_t> blocksA;
+    std::vector<size_t> blocksB;
+    T eps;
+
+    // 对角块方程 R_ii Z + Z S_jj = G (p x q，p, q <= 2)：按列展开成 pq 阶方程组，部分主元消元
+    void solveBlock(const Matrix<T>& R, size_t r0, size_t p, const Matrix<T>& S, size_t s0, size_t q,
+                    T G[2][2], T Z[2][2]) const {
+        const size_t m = p * q;
+        T M[4][5] = {};
+        // 未知量 z(i, j) 的编号 j * p + i
+        for (size_t j = 0; j < q; j++) {
+            for (size_t i = 0; i < p; i++) {
+                const size_t row = j * p + i;
+                for (size_t k = 0; k < p; k++) M[row][j * p + k] += R.at(r0 + i, r0 + k);
+                for (size_t k = 0; k < q; k++) M[row][k * p + i] += S.at(s0 + k, s0 + j);
+                M[row][m] = G[i][j];
+            }
+        }
+        // 奇异判定相对于 ||R_ii|| + ||S_jj||：整体缩小的 A、B 不应被误判为有公共特征值
+        T scale = T(0), normS = T(0);
+        for (size_t i = 0; i < p; i++)
+            for (size_t k = 0; k < p; k++) scale = std::max(scale, ScalarTraits<T>::abs(R.at(r0 + i, r0 + k)));
+        for (size_t i = 0; i < q; i++)
+            for (size_t k = 0; k < q; k++) normS = std::max(normS, ScalarTraits<T>::abs(S.at(s0 + i, s0 + k)));
+        scale += normS;
+        for (size_t c = 0; c < m; c++) {
+            size_t piv = c;
+            for (size_t r = c + 1; r < m; r++)
+                if (ScalarTraits<T>::abs(M[r][c]) > ScalarTraits<T>::abs(M[piv][c])) piv = r;
+            if (!(ScalarTraits<T>::abs(M[piv][c]) > eps * scale))
+                throw std::domain_error("Sylvester equation is singular (A and -B share an eigenvalue)");
+            if (piv != c)
+                for (size_t k = 0; k <= m; k++) std::swap(M[piv][k], M[c][k]);
+            for (size_t r = c + 1; r < m; r++) {
+                T f = M[r][c] / M[c][c];
+                for (size_t k = c; k <= m; k++) M[r][k] -= f * M[c][k];
+            }
+        }
+        T z[4];
+        for (size_t c = m; c-- > 0; ) {
+            T sum = M[c][m];
+            for (size_t k = c + 1; k < m; k++) sum -= M[c][k] * z[k];
+            z[c] = sum / M[c][c];
+        }
+        for (size_t j = 0; j < q; j++)
+            for (size_t i = 0; i < p; i++) Z[i][j] = z[j * p + i];
+    }
+
+    // R Y + Y S = F：S 的对角块从左到右、R 的对角块从下到上逐块回代
+    Matrix<T> solveTriangular(const Matrix<T>& F) const {
+        const Matrix<T>& R = schurA.S;
+        const Matrix<T>& S = schurB.S;
+        const size_t n = R.getRows(), m = S.getRows();
+        Matrix<T> Y(n, m);
+        for (size_t bj = 0; bj + 1 < blocksB.size(); bj++) {
+            const size_t s0 = blocksB[bj], q = blocksB[bj + 1] - s0;
+            // 右端项减去已求出的列块：F(:, J) - Y(:, <J) S(<J, J)
+            Matrix<T> rhs(n, q);
+            for (size_t i = 0; i < n; i++) {
+                for (size_t j = 0; j < q; j++) {
+                    T sum = F.at(i, s0 + j);
+                    for (size_t k = 0; k < s0; k++) sum -= Y.at(i, k) * S.at(k, s0 + j);
+                    rhs.at(i, j) = sum;
+                }
+            }
+            for (size_t bi = blocksA.size() - 1; bi-- > 0; ) {
+                const size_t r0 = blocksA[bi], p = blocksA[bi + 1] - r0;
+                T G[2][2], Z[2][2];
+                for (size_t i = 0; i < p; i++) {
+                    for (size_t j = 0; j < q; j++) {
+                        T sum = rhs.at(r0 + i, j);
+                        for (size_t k = r0 + p; k < n; k++) sum -= R.at(r0 + i, k) * Y.at(k, s0 + j);
+                        G[i][j] = sum;
+                    }
+                }
+                solveBlock(R, r0, p, S, s0, q, G, Z);
+                for (size_t i = 0; i < p; i++)
+                    for (size_t j = 0; j < q; j++) Y.at(r0 + i, s0 + j) = Z[i][j];
+            }
+        }
+        return Y;
+    }
+
+public:
+    // 分解 A、B 一次，之后 solve 可对任意多个右端项复用 Schur 因子
+    SylvesterSolver(const Matrix<T>& A, const Matrix<T>& B, T tol = ScalarTraits<T>::epsilon())
+        : eps(tol) {
+        static_assert(!ScalarTraits<T>::isExact, "SylvesterSolver requires a floating-point type");
+        if (!A.isSquare() || !B.isSquare()) throw std::invalid_argument("Must be square");
+        schurA = A.realSchur();
+        schurB = B.realSchur();
+        blocksA = schurA.blocks();
+        blocksB = schurB.blocks();
+    }
+
+    // Lyapunov 方程 A X + X A^T = Q 即 B = A^T 的 Sylvester 方程
+    static SylvesterSolver lyapunov(const Matrix<T>& A, T tol = ScalarTraits<T>::epsilon()) {
+        return SylvesterSolver(A, A.transpose(), tol);
+    }
+
+    // X = U Y V^T，其中 R Y + Y S = U^T C V
+    Matrix<T> solve(const Matrix<T>& C) const {
+        if (C.getRows() != schurA.S.getRows() || C.getCols() != schurB.S.getRows())
+            throw std::invalid_argument("Right-hand side size mismatch");
+        Matrix<T> F = schurA.Q.transpose() * C * schurB.Q;
+        return schurA.Q * solveTriangular(F) * schurB.Q.transpose();
+    }
+
+    std::vector<Matrix<T>> solve(const std::vector<Matrix<T>>& rhs) const {
+        std::vector<Matrix<T>> results;
+        results.reserve(rhs.size());
+        for (const auto& C : rhs) results.push_back(solve(C));
+        return results;
+    }
+
+    const typename Matrix<T>::SchurDecomposition& getSchurA() const noexcept { return schurA; }
+    const typename Matrix<T>::SchurDecomposition& getSchurB() const noexcept { return schurB; }
+};
+
+template <typename T>
+Matrix<T> solveSylvester(const Matrix<T>& A, const Matrix<T>& B, const Matrix<T>& C) {
+    return SylvesterSolver<T>(A, B).solve(C);
+}
+
+template <typename T>
+Matrix<T> solveLyapunov(const Matrix<T>& A, const Matrix<T>& Q) {
+    return SylvesterSolver<T>::lyapunov(A).solve(Q);
+}
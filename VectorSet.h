@@ -138,17 +138,26 @@ public:
 
             for (const auto& uj : orth) {
                 T ip_uj = uj.dot(uj);
-                if (std::abs(ip_uj) > 1e-9) {
+                if (!ScalarTraits<T>::isZero(ip_uj, ScalarTraits<T>::epsilon())) {
                     T coeff = v.dot(uj) / ip_uj;
                     u -= (uj * coeff);
                 }
             }
 
-            if (u.norm() < 1e-9)
-                continue;
+            // 精确类型 (如 Rational) 不开方，直接判 <u, u> == 0
+            if constexpr (ScalarTraits<T>::isExact) {
+                if (ScalarTraits<T>::isZero(u.dot(u), ScalarTraits<T>::epsilon()))
+                    continue;
+            } else {
+                if (u.norm() < ScalarTraits<T>::epsilon())
+                    continue;
+            }
 
             if (normalize) {
-                u = u.normalized();
+                if constexpr (ScalarTraits<T>::isExact)
+                    throw std::invalid_argument("Gram-Schmidt: exact scalar types cannot be normalized");
+                else
+                    u = u.normalized();
             }
 
             orth.push_back(u);
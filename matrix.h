@@ -8,10 +8,15 @@
 #include <stdexcept>
 #include <utility>
 #include <type_traits>
+#include <limits>
+#include "ScalarTraits.h"
 #include "vector.h"
+#include "Parallel.h"
+#include "SmallKernels.h"
 
-// 前置声明 RREF 类，解决循环依赖
-template <typename T> class RREF;
+// 前置声明 RREF 类与默认主元策略 (定义见 RREF.h)，解决循环依赖
+struct PartialPivoting;
+template <typename T, typename Pivoting = PartialPivoting> class RREF;
 
 template <typename T>
 class Matrix {
@@ -26,14 +31,123 @@ public:
         std::vector<Vector<T>> eigenvectors;
     };
 
+    // A = P D P^{-1}；PInverse 一并缓存 (对称矩阵的 P 正交，直接取 P^T)
     struct DiagonalizationResult {
         Matrix<T> P;
         Matrix<T> D;
+        Matrix<T> PInverse;
+
+        // A^k = P D^k P^{-1}：对角元逐个求幂，再做一次矩阵乘法，代价与 k 无关
+        Matrix<T> pow(unsigned long long k) const {
+            Matrix<T> scaled = P;
+            for (size_t j = 0; j < D.rows; j++) {
+                T dk = powScalar(D.data[j][j], k);
+                for (size_t i = 0; i < P.rows; i++) scaled.data[i][j] *= dk;
+            }
+            return scaled * PInverse;
+        }
     };
 
-    template <typename U>
+    // A = Q H Q^T：H 为上 Hessenberg 阵 (次对角线以下为零)，Q 正交
+    struct HessenbergDecomposition {
+        Matrix<T> Q;
+        Matrix<T> H;
+    };
+
+    // 实 Schur 分解 A = Q S Q^T：S 为拟上三角阵，对角线上 1x1 块为实特征值，
+    // 2x2 块对应一对共轭复特征值 (实特征值的 2x2 块已被旋转拆开)
+    struct SchurDecomposition {
+        Matrix<T> Q;
+        Matrix<T> S;
+
+        // 对角块 k 从第 blockStart(k) 行开始；返回每个对角块的起始下标，末尾追加 n
+        std::vector<size_t> blocks() const {
+            std::vector<size_t> starts;
+            const size_t n = S.rows;
+            for (size_t i = 0; i < n; ) {
+                starts.push_back(i);
+                i += (i + 1 < n && S.data[i + 1][i] != T(0)) ? 2 : 1;
+            }
+            starts.push_back(n);
+            return starts;
+        }
+    };
+
+    // PA = LU：LU 的严格下三角存 L (单位对角省略)，上三角存 U
+    // 分解一次即可对多个右端项重复调用 solve
+    struct LUDecomposition {
+        Matrix<T> LU;
+        std::vector<size_t> perm;
+        int sign = 1;
+
+        Vector<T> solve(const Vector<T>& b) const {
+            size_t n = LU.rows;
+            if (b.size() != n) throw std::invalid_argument("Right-hand side size mismatch");
+            std::vector<T> y(b.raw());
+            for (size_t k = 0; k < n; k++) {
+                if (perm[k] != k) std::swap(y[k], y[perm[k]]);
+            }
+            for (size_t i = 1; i < n; i++) {
+                const std::vector<T>& rowI = LU.data[i];
+                T s = y[i];
+                for (size_t j = 0; j < i; j++) s -= rowI[j] * y[j];
+                y[i] = s;
+            }
+            for (size_t i = n; i-- > 0; ) {
+                const std::vector<T>& rowI = LU.data[i];
+                T s = y[i];
+                for (size_t j = i + 1; j < n; j++) s -= rowI[j] * y[j];
+                y[i] = s / rowI[i];
+            }
+            return Vector<T>(std::move(y));
+        }
+
+        // 多右端项 A X = B：前代 / 回代都写成整行的 axpy，按列分块并行
+        Matrix<T> solve(const Matrix<T>& B) const {
+            size_t n = LU.rows;
+            if (B.rows != n) throw std::invalid_argument("Right-hand side size mismatch");
+            Matrix<T> X(B);
+            for (size_t k = 0; k < n; k++) {
+                if (perm[k] != k) std::swap(X.data[k], X.data[perm[k]]);
+            }
+            parallelFor(0, X.cols, 64, [&](size_t lo, size_t hi) {
+                for (size_t i = 1; i < n; i++) {
+                    T* xi = X.data[i].data();
+                    for (size_t j = 0; j < i; j++) {
+                        const T l = LU.data[i][j];
+                        const T* xj = X.data[j].data();
+                        for (size_t c = lo; c < hi; c++) xi[c] -= l * xj[c];
+                    }
+                }
+                for (size_t i = n; i-- > 0; ) {
+                    T* xi = X.data[i].data();
+                    for (size_t j = i + 1; j < n; j++) {
+                        const T u = LU.data[i][j];
+                        const T* xj = X.data[j].data();
+                        for (size_t c = lo; c < hi; c++) xi[c] -= u * xj[c];
+                    }
+                    const T d = LU.data[i][i];
+                    for (size_t c = lo; c < hi; c++) xi[c] /= d;
+                }
+            });
+            return X;
+        }
+    };
+
+    // det = sign * exp(logAbs)，奇异时 sign = 0, logAbs = -inf
+    // 整数类型的对数无法用 T 表示，logAbs 取 long double
+    using LogScalar = std::conditional_t<ScalarTraits<T>::isIntegral, long double, T>;
+    struct LogDeterminant {
+        int sign;
+        LogScalar logAbs;
+    };
+
+    template <typename U, typename Pivoting>
     friend class RREF;
 
+    template <typename U>
+    friend class Matrix;
+
     // -------- Constructors --------
     Matrix(size_t r, size_t r3)
         : rows(r), cols(r3), data(r, std::vector<T>(r3, T())) {
@@ -107,6 +221,19 @@ public:
         return mat;
     }
 
+    // 标量类型转换 (如 double -> float)
+    template <typename U>
+    Matrix<U> cast() const {
+        Matrix<U> result;
+        result.rows = rows;
+        result.cols = cols;
+        result.data.assign(rows, std::vector<U>(cols));
+        for (size_t i = 0; i < rows; i++)
+            for (size_t j = 0; j < cols; j++)
+                result.data[i][j] = static_cast<U>(data[i][j]);
+        return result;
+    }
+
     // -------- Basic Accessors --------
     size_t getRows() const noexcept { return rows; }
     size_t getCols() const noexcept { return cols; }
@@ -138,7 +265,7 @@ public:
                 if constexpr (std::is_floating_point_v<T>) {
                     if (std::abs(val) < 1e-9) val = static_cast<T>(0);
                 }
-                if (val == 0) std::cout << "\033[90m"; // 灰色表示0
+                if (val == T(0)) std::cout << "\033[90m"; // 灰色表示0
                 else std::cout << "\033[37m";
                 std::cout << std::setw(10) << val << " ";
                 std::cout << "\033[0m";
@@ -162,10 +289,8 @@ public:
     void scaleRow(size_t r, T scalar) {
         if (r >= rows)
             throw std::out_of_range("Row index out of bounds");
-        if (std::is_floating_point<T>::value) {
-            if (std::abs(static_cast<double>(scalar)) < 1e-9)
-                throw std::invalid_argument("Scaling factor too small");
-        }
+        if (ScalarTraits<T>::isZero(scalar, ScalarTraits<T>::epsilon()))
+            throw std::invalid_argument("Scaling factor too small");
         for (size_t j = 0; j < cols; j++) {
             data[r][j] *= scalar;
         }
@@ -175,9 +300,7 @@ public:
         if (targetRow >= rows || sourceRow >= rows)
             throw std::out_of_range("Row index out of bounds");
 
-        if (std::is_floating_point<T>::value) {
-            if (std::abs(static_cast<double>(scalar)) < 1e-9) return;
-        }
+        if (ScalarTraits<T>::isZero(scalar, ScalarTraits<T>::epsilon())) return;
 
         for (size_t j = 0; j < cols; j++) {
             data[targetRow][j] += data[sourceRow][j] * scalar;
@@ -217,10 +340,7 @@ public:
         if(cols != other.rows)
             throw std::invalid_argument("Matrix dimensions must match for multiplication");
         Matrix<T> result(rows, other.cols);
-        for(size_t i = 0; i < rows; i++)
-            for(size_t j = 0; j < other.cols; j++)
-                for(size_t k = 0; k < cols; k++)
-                    result.at(i,j) += data[i][k] * other.data[k][j];
+        multiplyInto(data, other.data, result.data);
         return result;
     }
 
@@ -246,7 +366,7 @@ public:
     }
 
     Matrix<T> operator/(T scalar) const {
-        if(std::fabs(scalar) < 1e-9)
+        if(ScalarTraits<T>::isZero(scalar, ScalarTraits<T>::epsilon()))
             throw std::invalid_argument("Scalar cannot be zero");
         Matrix<T> result(rows, cols);
         for(int i = 0; i < rows; i++)
@@ -285,11 +405,8 @@ public:
         if(cols != other.rows)
             throw std::invalid_argument("Matrix dimensions must match for multiplication");
         Matrix<T> result(rows, other.cols);
-        for(size_t i = 0; i < rows; i++)
-            for(size_t j = 0; j < other.cols; j++)
-                for(size_t k = 0; k < cols; k++)
-                    result.at(i,j) += data[i][k] * other.data[k][j];
-        *this = result;
+        multiplyInto(data, other.data, result.data);
+        *this = std::move(result);
         return *this;
     }
 
@@ -301,7 +418,7 @@ public:
     }
 
     Matrix<T>& operator/=(T scalar) {
-        if(std::fabs(scalar) < 1e-9)
+        if(ScalarTraits<T>::isZero(scalar, ScalarTraits<T>::epsilon()))
             throw std::invalid_argument("Scalar cannot be zero");
         for(int i = 0; i < rows; i++)
             for(int j = 0; j < cols; j++)
@@ -350,23 +467,23 @@ public:
         return result;
     }
 
-    bool isSymmetric(T eps = static_cast<T>(1e-9)) const {
+    bool isSymmetric(T eps = ScalarTraits<T>::epsilon()) const {
         if (rows != cols) return false;
         for (size_t i = 0; i < rows; i++) {
             for (size_t j = i + 1; j < cols; j++) {
-                if (std::abs(data[i][j] - data[j][i]) > eps)
+                if (!ScalarTraits<T>::isZero(data[i][j] - data[j][i], eps))
                     return false;
             }
         }
         return true;
     }
 
-    bool isSkewSymmetric(T eps = static_cast<T>(1e-9)) const {
+    bool isSkewSymmetric(T eps = ScalarTraits<T>::epsilon()) const {
         if(rows != cols) return false;
         for(int i = 0; i < rows; i++) {
             for(int j = i + 1; j < cols; j++) {
-                if(std::abs(data[i][i]) > eps) return false;
-                if(std::abs(data[i][j] + data[j][i]) > eps) return false;
+                if(!ScalarTraits<T>::isZero(data[i][i], eps)) return false;
+                if(!ScalarTraits<T>::isZero(data[i][j] + data[j][i], eps)) return false;
             }
         }
         return true;
@@ -380,40 +497,55 @@ public:
         }
     }
 
-    Matrix<T> getInverseMatrix(T eps = static_cast<T>(1e-9)) const {
+    // 基于部分主元 LU 的求逆 (GETRI 思路)：不先算行列式，也不构造 n x 2n 增广阵
+    // 额外工作区只有 n x n 的 LU 因子；逆矩阵第 i 行满足 A^T y = e_i，各行互相独立，分块并行求解
+    // n <= 4 直接用伴随矩阵公式，除结果外不分配工作区
+    // 奇异判定与 smallInverse / BatchedMatrix 一致：主元 |u_kk| <= eps * max|a_ij| 视为奇异
+    Matrix<T> getInverseMatrix(T eps = ScalarTraits<T>::epsilon()) const {
         if (this->rows != this->cols) throw std::invalid_argument("Matrix not square");
-        T det = this->determinant(eps);
-        if (std::abs(det) < eps) throw std::invalid_argument("Matrix is singular");
-        int n = static_cast<int>(this->getCols());
-        Matrix<T> augmentedMatrix = this->augment(Matrix<T>::identity(n));
-        for (int i = 0; i < n; i++) {
-            if (std::abs(augmentedMatrix.at(i, i)) < eps) throw std::invalid_argument("Numerical singularity");
-            T scale = augmentedMatrix.at(i, i);
-            for (int j = 0; j < 2 * n; j++) augmentedMatrix.at(i, j) /= scale;
-            for (int j = 0; j < n; j++) {
-                if (i != j) {
-                    T factor = augmentedMatrix.at(j, i);
-                    for (int k = 0; k < 2 * n; k++)
-                        augmentedMatrix.at(j, k) -= factor * augmentedMatrix.at(i, k);
+        size_t n = rows;
+        if (n == 0) return Matrix<T>();
+        if (n <= SmallKernels<T>::maxDim) return smallInverse(eps);
+        std::vector<std::vector<T>> lu(data);
+        std::vector<size_t> perm;
+        int sign = 1;
+        if (!luFactorInPlace(lu, perm, sign, relativePivotTolerance(eps))) throw std::invalid_argument("Matrix is singular");
+
+        // A = P^T L U  =>  A^T = U^T L^T P
+        Matrix<T> inverseMatrix(n, n);
+        parallelFor(0, n, 64, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; i++) {
+                std::vector<T>& y = inverseMatrix.data[i];
+                // U^T z = e_i：z 的前 i 个分量为 0，从第 i 个开始前代
+                y[i] = T(1);
+                for (size_t k = i; k < n; k++) {
+                    y[k] /= lu[k][k];
+                    const std::vector<T>& rowK = lu[k];
+                    for (size_t j = k + 1; j < n; j++) y[j] -= rowK[j] * y[k];
+                }
+                // L^T w = z：L 为单位下三角，按行做回代
+                for (size_t k = n; k-- > 1; ) {
+                    const std::vector<T>& rowK = lu[k];
+                    for (size_t j = 0; j < k; j++) y[j] -= rowK[j] * y[k];
+                }
+                // y = P^T w：逆序撤销行交换
+                for (size_t k = n; k-- > 0; ) {
+                    if (perm[k] != k) std::swap(y[k], y[perm[k]]);
                 }
             }
-        }
-        Matrix<T> inverseMatrix(n, n);
-        for (int i = 0; i < n; i++)
-            for (int j = 0; j < n; j++)
-                inverseMatrix.at(i, j) = augmentedMatrix.at(i, j + n);
+        });
         return inverseMatrix;
     }
 
-    bool isOrthogonal(T eps = static_cast<T>(1e-9)) const {
+    bool isOrthogonal(T eps = ScalarTraits<T>::epsilon()) const {
         if(this->getRows() != this->getCols()) throw std::invalid_argument("Must be square");
         Matrix<T> qt = this->transpose();
         Matrix<T> res = qt * (*this);
         for (size_t i = 0; i < rows; i++) {
             for (size_t j = 0; j < rows; j++) {
                 T val = res.at(i, j);
-                if (i == j) { if (std::abs(val - 1) > eps) return false; }
-                else { if (std::abs(val) > eps) return false; }
+                if (i == j) { if (!ScalarTraits<T>::isZero(val - T(1), eps)) return false; }
+                else { if (!ScalarTraits<T>::isZero(val, eps)) return false; }
             }
         }
         return true;
@@ -456,31 +588,88 @@ public:
 
     DiagonalizationResult diagonalize() const;
 
-    T determinant(T eps = static_cast<T>(1e-9)) const {
+    T determinant(T eps = ScalarTraits<T>::epsilon()) const {
         if (rows != cols) throw std::domain_error("Must be square");
+        if (rows == 0) return T(1);  // 空矩阵的行列式 (空积)
+        // 整数类型一律走 Bareiss：除法为整除，且每步经 __int128 检查溢出；
+        // 小矩阵的余子式展开直接用 T 相乘，溢出时是未定义行为，不能先于此分支
+        if constexpr (ScalarTraits<T>::isIntegral) return bareissDeterminant();
+        // n <= 4 余子式展开，不做任何除法，对有理数同样精确
+        if (rows <= SmallKernels<T>::maxDim) {
+            T det = SmallKernels<T>::dispatch(rows, [this](auto dim) {
+                return SmallKernels<T>::template determinant<decltype(dim)::value>(elementReader());
+            });
+            return ScalarTraits<T>::isZero(det, eps) ? T(0) : det;
+        }
         Matrix<T> temp(*this);
         T det = 1;
         int sign = 1;
         for (size_t i = 0; i < rows; i++) {
             size_t maxindex = i;
             for (size_t row = i + 1; row < rows; row++) {
-                if (std::abs(temp.data[row][i]) > std::abs(temp.data[maxindex][i]))
+                if (ScalarTraits<T>::magnitude(temp.data[row][i]) > ScalarTraits<T>::magnitude(temp.data[maxindex][i]))
                     maxindex = row;
             }
-            if (std::abs(temp.data[maxindex][i]) < eps) return 0;
+            if (ScalarTraits<T>::isZero(temp.data[maxindex][i], eps)) return T(0);
             if (maxindex != i) {
                 temp.exchangeRows(maxindex, i);
                 sign *= -1;
             }
             for (size_t row = i + 1; row < rows; row++) {
-                if (std::abs(temp.data[row][i]) < eps) continue;
+                if (ScalarTraits<T>::isZero(temp.data[row][i], eps)) continue;
                 T factor = -temp.data[row][i] / temp.data[i][i];
                 temp.addScaledRow(row, i, factor);
             }
         }
         det = static_cast<T>(sign);
         for (size_t i = 0; i < rows; i++) det *= temp.data[i][i];
-        return (std::abs(det) < eps) ? 0 : det;
+        return ScalarTraits<T>::isZero(det, eps) ? T(0) : det;
+    }
+
+    // 奇异判定与 getInverseMatrix 一致：主元 |u_kk| <= eps * max|a_ij| 视为奇异，与矩阵整体缩放无关
+    LUDecomposition luDecomposition(T eps = ScalarTraits<T>::epsilon()) const {
+        if (rows != cols) throw std::invalid_argument("Matrix not square");
+        LUDecomposition result;
+        result.LU = *this;
+        if (!luFactorInPlace(result.LU.data, result.perm, result.sign, relativePivotTolerance(eps)))
+            throw std::invalid_argument("Matrix is singular");
+        return result;
+    }
+
+    // 对数行列式：一次带主元分解同时得到符号与 log|det|，避免大矩阵主元连乘上溢/下溢
+    // 对称正定矩阵走 Cholesky 快速路径 (约 n^3/3 次乘法)，失败时退回部分主元 LU
+    // 整数类型：Cholesky / LU 的除法会截断，先用 Bareiss 求出精确行列式再取对数
+    LogDeterminant logAbsDeterminant() const {
+        if (rows != cols) throw std::domain_error("Must be square");
+        if constexpr (ScalarTraits<T>::isIntegral) {
+            const T det = bareissDeterminant();
+            if (det == T(0)) return {0, -std::numeric_limits<long double>::infinity()};
+            return {det < T(0) ? -1 : 1, std::log(static_cast<long double>(ScalarTraits<T>::abs(det)))};
+        } else {
+            LogDeterminant result{1, T(0)};
+
+            if (isSymmetric()) {
+                std::vector<std::vector<T>> L(data);
+                if (choleskyInPlace(L)) {
+                    for (size_t i = 0; i < rows; i++) result.logAbs += ScalarTraits<T>::log(L[i][i]);
+                    result.logAbs *= 2;
+                    return result;
+                }
+            }
+
+            std::vector<std::vector<T>> lu(data);
+            std::vector<size_t> perm;
+            if (!luFactorInPlace(lu, perm, result.sign, T(0))) {
+                // __float128 等扩展类型在严格模式下没有 numeric_limits 特化，借用 double 的无穷大
+                if constexpr (std::numeric_limits<T>::is_specialized) return {0, -std::numeric_limits<T>::infinity()};
+                else return {0, -static_cast<T>(std::numeric_limits<double>::infinity())};
+            }
+            for (size_t i = 0; i < rows; i++) {
+                if (lu[i][i] < T(0)) result.sign = -result.sign;
+                result.logAbs += ScalarTraits<T>::log(ScalarTraits<T>::abs(lu[i][i]));
+            }
+            return result;
+        }
     }
 
     Matrix<T> similarityTransform(const Matrix<T>& P) const {
@@ -493,8 +682,42 @@ public:
         if (rows != cols || other.rows != other.cols) return false;
         if (rows != other.rows) return false;
         if (this->rank() != other.rank()) return false;
-        if (this->determinant() != other.determinant()) return false;
-        return true;
+        // 精确类型先比行列式，便宜地排除；浮点下行列式的舍入误差由下面的容差比较 p[0] 覆盖
+        if constexpr (ScalarTraits<T>::isExact) {
+            if (this->determinant() != other.determinant()) return false;
+        }
+        // 相似矩阵的特征多项式相同 (涵盖迹、行列式与全部特征值)
+        std::vector<T> p = characteristicPolynomial(), q = other.characteristicPolynomial();
+        if constexpr (ScalarTraits<T>::isExact) {
+            return p == q;
+        } else {
+            // c_k 是特征值的 n - k 次初等对称多项式，|c_k| <= C(n, k) ||A||^(n-k)；
+            // 容差按这个量级缩放，应为 0 的系数 (如 ± 成对的特征值使奇次项抵消) 不会被绝对容差误判
+            const size_t n = rows;
+            const T norm = std::max({T(1), normInf(), other.normInf()});
+            T binom = T(1);  // C(n, k)
+            for (size_t k = 0; k <= n; k++) {
+                T bound = binom;
+                for (size_t e = k; e < n; e++) bound *= norm;
+                if (!ScalarTraits<T>::isZero(p[k] - q[k], ScalarTraits<T>::epsilon() * bound)) return false;
+                binom = binom * T(static_cast<int>(n - k)) / T(static_cast<int>(k + 1));
+            }
+            return true;
+        }
+    }
+
+    // 特征多项式 det(λI - A) 的系数，按升幂排列：c[0] + c[1] λ + ... + c[n] λ^n，c[n] = 1
+    // 整数环走无除法的 Berkowitz 算法 (精确，各阶前导子矩阵的 Toeplitz 列并行计算)；
+    // 其余类型先约化为上 Hessenberg 形，再用 Hyman 递推逐阶展开，O(n^3)
+    std::vector<T> characteristicPolynomial() const {
+        if (rows != cols) throw std::domain_error("Must be square");
+        if constexpr (ScalarTraits<T>::isIntegral) {
+            return berkowitzPolynomial();
+        } else {
+            // 浮点用正交相似 (Householder)；精确域用带主元的初等相似变换，避免开方
+            if constexpr (ScalarTraits<T>::isExact) return hessenbergPolynomial(eliminationHessenberg());
+            else return hessenbergPolynomial(hessenberg().H.data);
+        }
     }
 
     std::pair<Matrix<T>, Matrix<T>> qr_decomposition() const {
@@ -511,7 +734,7 @@ public:
                 u -= q_cols[j] * r_ji;
             }
             T r_ii = u.norm();
-            if (std::abs(r_ii) < 1e-9) q_cols.push_back(u);
+            if (ScalarTraits<T>::isZero(r_ii, ScalarTraits<T>::epsilon())) q_cols.push_back(u);
             else q_cols.push_back(u / r_ii);
         }
 
@@ -527,6 +750,119 @@ public:
         return {Q, R};
     }
 
+    // Householder 约化到上 Hessenberg 形：第 k 步用反射消去第 k 列次对角线以下的元素，约 10n^3/3 次运算
+    HessenbergDecomposition hessenberg() const {
+        static_assert(!ScalarTraits<T>::isExact, "Hessenberg reduction requires a floating-point type");
+        if (rows != cols) throw std::invalid_argument("Must be square");
+        const size_t n = rows;
+        HessenbergDecomposition result{identity(static_cast<int>(n)), *this};
+        std::vector<T> v(n);
+        for (size_t k = 0; k + 2 < n; k++) {
+            const size_t len = n - k - 1;
+            for (size_t i = 0; i < len; i++) v[i] = result.H.data[k + 1 + i][k];
+            T tau = householderVector(v.data(), len);
+            if (tau == T(0)) continue;
+            reflectRows(result.H.data, v.data(), len, tau, k + 1, k, n);
+            reflectCols(result.H.data, v.data(), len, tau, k + 1, 0, n);
+            reflectCols(result.Q.data, v.data(), len, tau, k + 1, 0, n);
+            for (size_t i = k + 2; i < n; i++) result.H.data[i][k] = T(0);
+        }
+        return result;
+    }
+
+    // 实 Schur 分解：Hessenberg 约化 + Francis 隐式双位移 QR (Golub & Van Loan 算法 7.5.2)
+    // 每次迭代 O(n^2)，总代价约 25n^3；不收敛时抛出 domain_error
+    SchurDecomposition realSchur() const {
+        HessenbergDecomposition hq = hessenberg();
+        SchurDecomposition result{std::move(hq.Q), std::move(hq.H)};
+        auto& H = result.S.data;
+        auto& Q = result.Q.data;
+        const size_t n = rows;
+
+        T unit = T(1e-30);
+        if constexpr (std::numeric_limits<T>::is_specialized) unit = std::numeric_limits<T>::epsilon();
+        const T normH = result.S.normFrobenius();
+        auto abs = [](const T& x) { return ScalarTraits<T>::abs(x); };
+
+        size_t p = n - 1;
+        int iter = 0;
+        while (p > 0) {
+            // 从底部向上找可忽略的次对角元，确定活动窗口 [l, p]
+            size_t l = p;
+            for (; l > 0; l--) {
+                T scale = abs(H[l - 1][l - 1]) + abs(H[l][l]);
+                if (scale == T(0)) scale = normH;
+                if (abs(H[l][l - 1]) <= unit * scale) {
+                    H[l][l - 1] = T(0);
+                    break;
+                }
+            }
+
+            if (l == p) {
+                p--;
+                iter = 0;
+                continue;
+            }
+            if (l + 1 == p) {
+                splitRealPair(result, p - 1);
+                if (p == 1) break;
+                p -= 2;
+                iter = 0;
+                continue;
+            }
+            if (++iter > 30 * static_cast<int>(n)) throw std::domain_error("Schur iteration failed to converge");
+
+            // 位移取右下 2x2 块的两个特征值 (和 s、积 t)；迭代停滞时改用特殊位移打破循环
+            T s, t;
+            if (iter % 10 == 0) {
+                T e, h;
+                if (iter % 20 == 0) {
+                    e = abs(H[p][p - 1]) + abs(H[p - 1][p - 2]);
+                    h = T(0.75) * e + H[p][p];
+                } else {
+                    e = abs(H[l + 1][l]) + abs(H[l + 2][l + 1]);
+                    h = T(0.75) * e + H[l][l];
+                }
+                s = h + h;
+                t = h * h + T(0.4375) * e * e;
+            } else {
+                s = H[p - 1][p - 1] + H[p][p];
+                t = H[p - 1][p - 1] * H[p][p] - H[p - 1][p] * H[p][p - 1];
+            }
+
+            // (H - σ1 I)(H - σ2 I) e_1 的前三个分量，随后沿次对角线追赶凸起 (bulge chasing)
+            T x = H[l][l] * H[l][l] + H[l][l + 1] * H[l + 1][l] - s * H[l][l] + t;
+            T y = H[l + 1][l] * (H[l][l] + H[l + 1][l + 1] - s);
+            T z = H[l + 1][l] * H[l + 2][l + 1];
+            for (size_t k = l; k + 2 <= p; k++) {
+                T v[3] = {x, y, z};
+                T tau = householderVector(v, 3);
+                if (tau != T(0)) {
+                    const size_t c0 = k > l ? k - 1 : l;
+                    reflectRows(H, v, 3, tau, k, c0, n);
+                    reflectCols(H, v, 3, tau, k, 0, std::min(k + 4, p + 1));
+                    reflectCols(Q, v, 3, tau, k, 0, n);
+                }
+                if (k > l) {
+                    H[k + 1][k - 1] = T(0);
+                    H[k + 2][k - 1] = T(0);
+                }
+                x = H[k + 1][k];
+                y = H[k + 2][k];
+                if (k + 3 <= p) z = H[k + 3][k];
+            }
+            T v[2] = {x, y};
+            T tau = householderVector(v, 2);
+            if (tau != T(0)) {
+                reflectRows(H, v, 2, tau, p - 1, p - 2, n);
+                reflectCols(H, v, 2, tau, p - 1, 0, p + 1);
+                reflectCols(Q, v, 2, tau, p - 1, 0, n);
+            }
+            H[p][p - 2] = T(0);
+        }
+        return result;
+    }
+
     // 矩阵 1-范数：列模和的最大值
     T norm1() const {
         if (cols == 0) return 0;
@@ -534,7 +870,7 @@ public:
         for (size_t j = 0; j < cols; j++) {
             T colSum = 0;
             for (size_t i = 0; i < rows; i++) {
-                colSum += std::abs(data[i][j]);
+                colSum += ScalarTraits<T>::abs(data[i][j]);
             }
             if (j == 0 || colSum > maxColSum) maxColSum = colSum;
         }
@@ -548,7 +884,7 @@ public:
         for (size_t i = 0; i < rows; i++) {
             T rowSum = 0;
             for (size_t j = 0; j < cols; j++) {
-                rowSum += std::abs(data[i][j]);
+                rowSum += ScalarTraits<T>::abs(data[i][j]);
             }
             if (i == 0 || rowSum > maxRowSum) maxRowSum = rowSum;
         }
@@ -563,7 +899,482 @@ public:
                 sumSq += data[i][j] * data[i][j];
             }
         }
-        return std::sqrt(sumSq);
+        return ScalarTraits<T>::sqrt(sumSq);
+    }
+
+    // A^k：二进制快速幂，ping-pong 两块工作区轮换，循环内不再分配内存
+    // 约 2 log2(k) 次矩阵乘法；整数 / 精确类型同样适用
+    Matrix<T> pow(unsigned long long k) const {
+        if (rows != cols) throw std::domain_error("Must be square");
+        if (k == 0) return identity(static_cast<int>(rows));
+
+        // base 依次为 A, A^2, A^4, ...；result 在第一次遇到置位比特时直接取 base，省去与单位阵相乘
+        Matrix<T> base = *this;
+        Matrix<T> result(rows, cols);
+        Matrix<T> scratch(rows, cols);
+        bool started = false;
+        auto multiplySwap = [&scratch](Matrix<T>& target, const Matrix<T>& a, const Matrix<T>& b) {
+            for (auto& row : scratch.data) std::fill(row.begin(), row.end(), T(0));
+            multiplyInto(a.data, b.data, scratch.data);
+            std::swap(target.data, scratch.data);
+        };
+        for (;;) {
+            if (k & 1) {
+                if (started) multiplySwap(result, result, base);
+                else result.data = base.data;
+                started = true;
+            }
+            k >>= 1;
+            if (k == 0) break;
+            multiplySwap(base, base, base);
+        }
+        return result;
+    }
+
+    // 经缓存的对角化求 A^k：对多个 k 反复求幂 (如 Markov 链的 n 步转移) 时只需分解一次
+    // 用法: auto diag = A.diagonalize(); diag.pow(k)
+    Matrix<T> pow(unsigned long long k, const DiagonalizationResult& diag) const {
+        if (diag.P.rows != rows || diag.P.cols != cols) throw std::invalid_argument("Diagonalization size mismatch");
+        return diag.pow(k);
+    }
+
+    // 矩阵指数 e^A：Higham (2005) 缩放-平方 + Padé 近似
+    // ||A||_1 不超过 θ_m 时直接用 m = 3/5/7/9 阶 Padé；否则缩放 A / 2^s 使其落入 θ_13，再平方 s 次
+    // 代价约 (6 + s) 次矩阵乘法 + 一次 LU 分解 (n 个右端项共用)，对亏损 (不可对角化) 矩阵同样正确
+    Matrix<T> exp() const {
+        static_assert(!ScalarTraits<T>::isIntegral, "Matrix exponential requires a field type");
+        if (rows != cols) throw std::domain_error("Must be square");
+        const size_t n = rows;
+
+        // Padé 系数 b_0 .. b_m (分子 / 分母共用，分母奇次项取负)
+        static const long long b3[] = {120, 60, 12, 1};
+        static const long long b5[] = {30240, 15120, 3360, 420, 30, 1};
+        static const long long b7[] = {17297280, 8648640, 1995840, 277200, 25200, 1512, 56, 1};
+        static const long long b9[] = {17643225600LL, 8821612800LL, 2075673600LL, 302702400LL, 30270240LL,
+                                       2162160LL, 110880LL, 3960LL, 90LL, 1LL};
+        static const long long b13[] = {64764752532480000LL, 32382376266240000LL, 7771770303897600LL,
+                                        1187353796428800LL, 129060195264000LL, 10559470521600LL, 670442572800LL,
+                                        33522128640LL, 1323241920LL, 40840800LL, 960960LL, 16380LL, 182LL, 1LL};
+        static const double theta[] = {1.495585217958292e-2, 2.539398330063230e-1,
+                                       9.504178996162932e-1, 2.097847961257068e0};
+        static const double theta13 = 5.371920351148152e0;
+
+        auto axpy = [n](Matrix<T>& acc, const T& c, const Matrix<T>& X) {
+            for (size_t i = 0; i < n; i++)
+                for (size_t j = 0; j < n; j++) acc.data[i][j] += c * X.data[i][j];
+        };
+        auto addIdentity = [n](Matrix<T>& acc, const T& c) {
+            for (size_t i = 0; i < n; i++) acc.data[i][i] += c;
+        };
+        // (V - U) R = (V + U)
+        auto padeSolve = [](const Matrix<T>& U, const Matrix<T>& V) {
+            return (V - U).luDecomposition(T(0)).solve(V + U);
+        };
+
+        // θ_m 按 double 的单位舍入选取；精度更高的类型 (double-double 等) 只用 13 阶并多缩放 extra 次：
+        // Padé 截断误差约正比于 ||A||^27，每多缩放一次误差降为 2^-27 倍
+        int extra = 0;
+        if constexpr (std::numeric_limits<T>::is_specialized) {
+            const double unitT = static_cast<double>(std::numeric_limits<T>::epsilon());
+            const double unitD = std::numeric_limits<double>::epsilon();
+            if (unitT > 0 && unitT < unitD) extra = static_cast<int>(std::ceil(std::log2(unitD / unitT) / 27));
+        }
+
+        const double norm = static_cast<double>(norm1());
+        const long long* lowOrder[] = {b3, b5, b7, b9};
+        for (int idx = 0; idx < 4 && extra == 0; idx++) {
+            if (norm > theta[idx]) continue;
+            const int m = 3 + 2 * idx;
+            const long long* b = lowOrder[idx];
+            // U = A * sum b_{2k+1} A^{2k}，V = sum b_{2k} A^{2k}
+            Matrix<T> A2 = (*this) * (*this);
+            Matrix<T> power = A2;
+            Matrix<T> odd(n, n), V(n, n);
+            addIdentity(odd, T(b[1]));
+            addIdentity(V, T(b[0]));
+            for (int k = 2; k <= m; k += 2) {
+                axpy(odd, T(b[k + 1]), power);
+                axpy(V, T(b[k]), power);
+                if (k + 2 <= m) power = power * A2;
+            }
+            return padeSolve((*this) * odd, V);
+        }
+
+        int s = (norm > theta13 ? static_cast<int>(std::ceil(std::log2(norm / theta13))) : 0) + extra;
+        Matrix<T> A = (*this) * T(std::ldexp(1.0, -s));  // 2 的幂缩放无舍入误差
+        Matrix<T> A2 = A * A;
+        Matrix<T> A4 = A2 * A2;
+        Matrix<T> A6 = A4 * A2;
+
+        const long long* b = b13;
+        Matrix<T> inner(n, n);
+        axpy(inner, T(b[13]), A6);
+        axpy(inner, T(b[11]), A4);
+        axpy(inner, T(b[9]), A2);
+        Matrix<T> odd = A6 * inner;
+        axpy(odd, T(b[7]), A6);
+        axpy(odd, T(b[5]), A4);
+        axpy(odd, T(b[3]), A2);
+        addIdentity(odd, T(b[1]));
+
+        Matrix<T> innerV(n, n);
+        axpy(innerV, T(b[12]), A6);
+        axpy(innerV, T(b[10]), A4);
+        axpy(innerV, T(b[8]), A2);
+        Matrix<T> V = A6 * innerV;
+        axpy(V, T(b[6]), A6);
+        axpy(V, T(b[4]), A4);
+        axpy(V, T(b[2]), A2);
+        addIdentity(V, T(b[0]));
+
+        Matrix<T> R = padeSolve(A * odd, V);
+        for (int k = 0; k < s; k++) R = R * R;
+        return R;
+    }
+
+private:
+    // -------- Householder Reflectors --------
+    // 输入 x (长度 len)，原地改写为 v，使 (I - tau v v^T) x = -sign(x_0) ||x|| e_1；x = 0 时返回 tau = 0
+    static T householderVector(T* v, size_t len) {
+        T alpha = T(0);
+        for (size_t i = 0; i < len; i++) alpha += v[i] * v[i];
+        if (alpha == T(0)) return T(0);
+        T norm = ScalarTraits<T>::sqrt(alpha);
+        if (v[0] < T(0)) norm = -norm;
+        v[0] += norm;
+        return T(1) / (norm * v[0]);  // 2 / v^T v，其中 v^T v = 2 (alpha + |x_0| ||x||)
+    }
+
+    // 行 r0 .. r0+len-1、列 [c0, c1) 左乘反射
+    static void reflectRows(std::vector<std::vector<T>>& a, const T* v, size_t len, T tau,
+                            size_t r0, size_t c0, size_t c1) {
+        for (size_t j = c0; j < c1; j++) {
+            T s = T(0);
+            for (size_t i = 0; i < len; i++) s += v[i] * a[r0 + i][j];
+            s *= tau;
+            for (size_t i = 0; i < len; i++) a[r0 + i][j] -= s * v[i];
+        }
+    }
+
+    // 列 c0 .. c0+len-1、行 [r0, r1) 右乘反射
+    static void reflectCols(std::vector<std::vector<T>>& a, const T* v, size_t len, T tau,
+                            size_t c0, size_t r0, size_t r1) {
+        for (size_t i = r0; i < r1; i++) {
+            T* ai = a[i].data() + c0;
+            T s = T(0);
+            for (size_t k = 0; k < len; k++) s += ai[k] * v[k];
+            s *= tau;
+            for (size_t k = 0; k < len; k++) ai[k] -= s * v[k];
+        }
+    }
+
+    // 已收敛的 2x2 对角块 (行 / 列 k, k+1)：特征值为实数时用一次旋转化为上三角，复数时保留
+    static void splitRealPair(SchurDecomposition& schur, size_t k) {
+        auto& H = schur.S.data;
+        auto& Q = schur.Q.data;
+        const size_t n = H.size();
+        const T a = H[k][k], b = H[k][k + 1], c = H[k + 1][k], d = H[k + 1][k + 1];
+        if (c == T(0)) return;
+        const T half = (a - d) / T(2);
+        const T disc = half * half + b * c;
+        if (disc < T(0)) return;
+
+        // λ 取远离 (a + d) / 2 一侧以免抵消；特征向量 (b, λ - a) 与 (λ - d, c) 取较长者
+        const T root = ScalarTraits<T>::sqrt(disc);
+        const T lambda = (a + d) / T(2) + (half >= T(0) ? root : -root);
+        T u0 = b, u1 = lambda - a;
+        if (ScalarTraits<T>::abs(lambda - d) + ScalarTraits<T>::abs(c) >
+            ScalarTraits<T>::abs(u0) + ScalarTraits<T>::abs(u1)) {
+            u0 = lambda - d;
+            u1 = c;
+        }
+        const T len = ScalarTraits<T>::sqrt(u0 * u0 + u1 * u1);
+        if (len == T(0)) return;
+        const T cs = u0 / len, sn = u1 / len;
+        // G = [[cs, -sn], [sn, cs]]：H <- G^T H G，Q <- Q G
+        for (size_t j = 0; j < n; j++) {
+            const T h0 = H[k][j], h1 = H[k + 1][j];
+            H[k][j] = cs * h0 + sn * h1;
+            H[k + 1][j] = -sn * h0 + cs * h1;
+        }
+        for (size_t i = 0; i < n; i++) {
+            const T h0 = H[i][k], h1 = H[i][k + 1];
+            H[i][k] = cs * h0 + sn * h1;
+            H[i][k + 1] = -sn * h0 + cs * h1;
+            const T q0 = Q[i][k], q1 = Q[i][k + 1];
+            Q[i][k] = cs * q0 + sn * q1;
+            Q[i][k + 1] = -sn * q0 + cs * q1;
+        }
+        H[k + 1][k] = T(0);
+    }
+
+    // -------- Characteristic Polynomial --------
+    // 初等相似变换约化到上 Hessenberg 形 (EISPACK elmhes)：选主元交换行列，再用第 m 行消去下方元素并对列做逆变换
+    std::vector<std::vector<T>> eliminationHessenberg() const {
+        std::vector<std::vector<T>> a(data);
+        const size_t n = rows;
+        for (size_t m = 1; m + 1 < n; m++) {
+            size_t piv = m;
+            for (size_t i = m + 1; i < n; i++) {
+                if (ScalarTraits<T>::magnitude(a[i][m - 1]) > ScalarTraits<T>::magnitude(a[piv][m - 1])) piv = i;
+            }
+            if (a[piv][m - 1] == T(0)) continue;
+            if (piv != m) {
+                std::swap(a[piv], a[m]);
+                for (size_t i = 0; i < n; i++) std::swap(a[i][piv], a[i][m]);
+            }
+            for (size_t i = m + 1; i < n; i++) {
+                if (a[i][m - 1] == T(0)) continue;
+                const T y = a[i][m - 1] / a[m][m - 1];
+                for (size_t j = m - 1; j < n; j++) a[i][j] -= y * a[m][j];
+                for (size_t r = 0; r < n; r++) a[r][m] += y * a[r][i];
+            }
+        }
+        return a;
+    }
+
+    // Hyman 递推：p_k 为前 k 阶主子阵的特征多项式
+    // p_k = (λ - h_{k,k}) p_{k-1} - Σ_{i<k} h_{i,k} (h_{i+1,i} ... h_{k,k-1}) p_{i-1}
+    static std::vector<T> hessenbergPolynomial(const std::vector<std::vector<T>>& h) {
+        const size_t n = h.size();
+        std::vector<std::vector<T>> p(n + 1);
+        p[0] = {T(1)};
+        for (size_t k = 1; k <= n; k++) {
+            std::vector<T>& pk = p[k];
+            pk.assign(k + 1, T(0));
+            const T diag = h[k - 1][k - 1];
+            for (size_t d = 0; d < k; d++) {
+                pk[d + 1] += p[k - 1][d];
+                pk[d] -= diag * p[k - 1][d];
+            }
+            T prod = T(1);
+            for (size_t i = k - 1; i >= 1; i--) {
+                prod *= h[i][i - 1];
+                if (prod == T(0)) break;
+                const T coef = h[i - 1][k - 1] * prod;
+                for (size_t d = 0; d < i; d++) pk[d] -= coef * p[i - 1][d];
+            }
+        }
+        return p[n];
+    }
+
+    // Berkowitz：前 r+1 阶主子阵的特征多项式 = Toeplitz(1, -a, -R C, -R A_r C, ...) · p_r
+    // 只有加减乘，整数 / BigInt 结果精确；各阶的 Toeplitz 列互不依赖，按 r 交错分给各线程使负载均衡
+    std::vector<T> berkowitzPolynomial() const {
+        const size_t n = rows;
+        std::vector<std::vector<T>> toeplitz(n);
+        const size_t workers = std::min<size_t>(n, parallelConcurrency());
+        // 溢出异常由 parallelFor 在所有块结束后于调用线程重新抛出
+        parallelFor(0, workers, 1, [&](size_t lo, size_t hi) {
+            std::vector<T> v, w;
+            for (size_t start = lo; start < hi; start++) {
+                for (size_t r = start; r < n; r += workers) {
+                    // col = [1, -a_rr, -R C, -R A_r C, ..., -R A_r^{r-1} C]
+                    std::vector<T>& col = toeplitz[r];
+                    col.assign(r + 2, T(0));
+                    col[0] = T(1);
+                    col[1] = checkedMultiplyAdd(T(0), data[r][r], T(-1));
+                    v.assign(r, T(0));
+                    for (size_t i = 0; i < r; i++) v[i] = data[i][r];
+                    for (size_t k = 0; k < r; k++) {
+                        T dot = T(0);
+                        for (size_t j = 0; j < r; j++) dot = checkedMultiplyAdd(dot, data[r][j], v[j]);
+                        col[k + 2] = checkedMultiplyAdd(T(0), dot, T(-1));
+                        if (k + 1 == r) break;
+                        w.assign(r, T(0));
+                        for (size_t i = 0; i < r; i++) {
+                            T sum = T(0);
+                            for (size_t j = 0; j < r; j++) sum = checkedMultiplyAdd(sum, data[i][j], v[j]);
+                            w[i] = sum;
+                        }
+                        std::swap(v, w);
+                    }
+                }
+            }
+        });
+
+        // 降幂系数：q_{r+1}[i] = Σ_j col[i - j] q_r[j]
+        std::vector<T> q = {T(1)};
+        for (size_t r = 0; r < n; r++) {
+            std::vector<T> next(r + 2, T(0));
+            for (size_t i = 0; i < r + 2; i++)
+                for (size_t j = 0; j <= std::min(i, r); j++) next[i] = checkedMultiplyAdd(next[i], toeplitz[r][i - j], q[j]);
+            q = std::move(next);
+        }
+        std::reverse(q.begin(), q.end());
+        return q;
+    }
+
+    static T powScalar(T x, unsigned long long k) {
+        T r = T(1);
+        for (; k; k >>= 1) {
+            if (k & 1) r *= x;
+            if (k > 1) x *= x;
+        }
+        return r;
+    }
+
+    // -------- Product Kernel --------
+    // C += A B：i-k-j 次序，最内层是 C 的一行加上 B 的一行的倍数 (连续访存、可向量化)；
+    // k / j 分块使 B 的一块留在缓存中，行块之间并行
+    static void multiplyInto(const std::vector<std::vector<T>>& a, const std::vector<std::vector<T>>& b,
+                             std::vector<std::vector<T>>& c) {
+        const size_t m = a.size();
+        const size_t inner = b.size();
+        const size_t p = b.empty() ? 0 : b[0].size();
+        constexpr size_t kBlock = 128;
+        constexpr size_t jBlock = 512;
+        const size_t grain = std::max<size_t>(1, (size_t(1) << 16) / std::max<size_t>(1, inner * p));
+        parallelFor(0, m, grain, [&](size_t lo, size_t hi) {
+            for (size_t kk = 0; kk < inner; kk += kBlock) {
+                const size_t kEnd = std::min(inner, kk + kBlock);
+                for (size_t jj = 0; jj < p; jj += jBlock) {
+                    const size_t jEnd = std::min(p, jj + jBlock);
+                    for (size_t i = lo; i < hi; i++) {
+                        T* ci = c[i].data();
+                        const std::vector<T>& ai = a[i];
+                        for (size_t k = kk; k < kEnd; k++) {
+                            const T aik = ai[k];
+                            const T* bk = b[k].data();
+                            for (size_t j = jj; j < jEnd; j++) ci[j] += aik * bk[j];
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+    // -------- Small-Dimension Kernels --------
+    auto elementReader() const {
+        return [this](size_t i, size_t j) -> const T& { return data[i][j]; };
+    }
+
+    Matrix<T> smallInverse(T eps) const {
+        Matrix<T> inv(rows, cols);
+        auto out = [&inv](size_t i, size_t j) -> T& { return inv.data[i][j]; };
+        SmallKernels<T>::dispatch(rows, [&](auto dim) {
+            constexpr size_t N = decltype(dim)::value;
+            T det = SmallKernels<T>::template adjugate<N>(elementReader(), out);
+            if (SmallKernels<T>::template isSingular<N>(det, elementReader(), eps))
+                throw std::invalid_argument("Matrix is singular");
+            for (size_t i = 0; i < N; i++)
+                for (size_t j = 0; j < N; j++) inv.data[i][j] /= det;
+        });
+        return inv;
+    }
+
+    // -------- Factorization Kernels --------
+    // 浮点类型的主元阈值 eps * max|a_ij|；精确类型判零不用容差，原样返回
+    T relativePivotTolerance(T eps) const {
+        if constexpr (ScalarTraits<T>::isExact) {
+            return eps;
+        } else {
+            T maxAbs = T(0);
+            for (const auto& row : data)
+                for (const T& x : row) maxAbs = std::max(maxAbs, ScalarTraits<T>::magnitude(x));
+            return eps * maxAbs;
+        }
+    }
+
+    // 部分主元原地 LU (Doolittle)：严格下三角存 L (单位对角省略)，上三角存 U
+    // perm[k] 为第 k 步换到主元位置的行号；行交换只交换行指针
+    // 主元为 0 或按 ScalarTraits 判零 (浮点即 |u_kk| < eps) 时视为奇异，返回 false
+    static bool luFactorInPlace(std::vector<std::vector<T>>& a, std::vector<size_t>& perm,
+                                int& sign, T eps) {
+        size_t n = a.size();
+        perm.assign(n, 0);
+        sign = 1;
+        for (size_t k = 0; k < n; k++) {
+            size_t p = k;
+            for (size_t i = k + 1; i < n; i++) {
+                if (ScalarTraits<T>::magnitude(a[i][k]) > ScalarTraits<T>::magnitude(a[p][k])) p = i;
+            }
+            perm[k] = p;
+            if (a[p][k] == T(0) || ScalarTraits<T>::isZero(a[p][k], eps)) return false;
+            if (p != k) {
+                std::swap(a[p], a[k]);
+                sign = -sign;
+            }
+            const std::vector<T>& rowK = a[k];
+            for (size_t i = k + 1; i < n; i++) {
+                std::vector<T>& rowI = a[i];
+                T l = rowI[k] / rowK[k];
+                rowI[k] = l;
+                if (l == T(0)) continue;
+                for (size_t j = k + 1; j < n; j++) rowI[j] -= l * rowK[j];
+            }
+        }
+        return true;
+    }
+
+    // acc + x*y：内置 64 位整数同样在 __int128 中计算并检查范围，供 Berkowitz 的累加使用
+    static T checkedMultiplyAdd(const T& acc, const T& x, const T& y) {
+        if constexpr (std::is_integral_v<T> && sizeof(T) <= sizeof(long long)) {
+            __int128 r = static_cast<__int128>(acc) + static_cast<__int128>(x) * y;
+            if (r > std::numeric_limits<T>::max() || r < std::numeric_limits<T>::min())
+                throw std::overflow_error("Berkowitz: coefficient exceeds integer range (use BigInt)");
+            return static_cast<T>(r);
+        } else {
+            return acc + x * y;
+        }
+    }
+
+    // Bareiss 单步更新 (a*b - c*d) / e：由 Sylvester 恒等式保证整除
+    // 内置 64 位整数在 __int128 中计算乘积，结果超出 T 的范围时抛出 overflow_error
+    static T fractionFreeUpdate(const T& a, const T& b, const T& c, const T& d, const T& e) {
+        if constexpr (std::is_integral_v<T> && sizeof(T) <= sizeof(long long)) {
+            __int128 r = (static_cast<__int128>(a) * b - static_cast<__int128>(c) * d) / e;
+            if (r > std::numeric_limits<T>::max() || r < std::numeric_limits<T>::min())
+                throw std::overflow_error("Bareiss: entry exceeds integer range (use BigInt)");
+            return static_cast<T>(r);
+        } else {
+            return (a * b - c * d) / e;
+        }
+    }
+
+    // Bareiss 无除法消元求行列式：第 k 步后每个元素都是 (k+1) 阶子式，
+    // 大小受 Hadamard 界约束，整数结果精确且为多项式时间
+    T bareissDeterminant() const {
+        std::vector<std::vector<T>> a(data);
+        size_t n = rows;
+        bool negate = false;
+        T prev = T(1);
+        for (size_t k = 0; k < n; k++) {
+            size_t p = k;
+            while (p < n && a[p][k] == T(0)) p++;
+            if (p == n) return T(0);
+            if (p != k) {
+                std::swap(a[p], a[k]);
+                negate = !negate;
+            }
+            const std::vector<T>& rowK = a[k];
+            for (size_t i = k + 1; i < n; i++) {
+                std::vector<T>& rowI = a[i];
+                for (size_t j = k + 1; j < n; j++)
+                    rowI[j] = fractionFreeUpdate(rowI[j], rowK[k], rowI[k], rowK[j], prev);
+            }
+            prev = rowK[k];
+        }
+        return negate ? T(-prev) : prev;
+    }
+
+    // 原地 Cholesky：下三角存 L (A = L L^T)，遇到非正主元返回 false (非正定)
+    static bool choleskyInPlace(std::vector<std::vector<T>>& a) {
+        size_t n = a.size();
+        for (size_t j = 0; j < n; j++) {
+            std::vector<T>& rowJ = a[j];
+            T d = rowJ[j];
+            for (size_t k = 0; k < j; k++) d -= rowJ[k] * rowJ[k];
+            if (!(d > T(0))) return false;
+            rowJ[j] = ScalarTraits<T>::sqrt(d);
+            for (size_t i = j + 1; i < n; i++) {
+                std::vector<T>& rowI = a[i];
+                T s = rowI[j];
+                for (size_t k = 0; k < j; k++) s -= rowI[k] * rowJ[k];
+                rowI[j] = s / rowJ[j];
+            }
+        }
+        return true;
     }
 };
 
@@ -0,0 +1,177 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include "BatchedMatrix.h"
+
+// 逐个矩阵与 Matrix<double> 的结果比对
+template <size_t N>
+void testBatch() {
+    const size_t count = 37;
+    BatchedMatrix<double, N> A(count), B(count);
+    BatchedVector<double, N> b(count);
+    for (size_t k = 0; k < count; k++) {
+        for (size_t i = 0; i < N; i++) {
+            b.at(k, i) = std::sin(double(k + 3 * i));
+            for (size_t j = 0; j < N; j++) {
+                A.at(k, i, j) = std::cos(double(k * 7 + i * N + j)) + (i == j ? 2.0 : 0.0);
+                B.at(k, i, j) = std::sin(double(k + i + 2 * j));
+            }
+        }
+    }
+
+    std::vector<double> det = A.determinant();
+    BatchedMatrix<double, N> inv = A.getInverseMatrix();
+    BatchedVector<double, N> x = A.solve(b);
+    BatchedMatrix<double, N> P = A * B;
+    BatchedVector<double, N> Ax = A * x;
+
+    for (size_t k = 0; k < count; k++) {
+        Matrix<double> M = A.get(k);
+        assert(std::abs(M.determinant() - det[k]) < 1e-9);
+        Matrix<double> I = M * inv.get(k);
+        Matrix<double> MB = M * B.get(k);
+        for (size_t i = 0; i < N; i++) {
+            assert(std::abs(Ax.at(k, i) - b.at(k, i)) < 1e-9);
+            for (size_t j = 0; j < N; j++) {
+                assert(std::abs(I.at(i, j) - (i == j ? 1.0 : 0.0)) < 1e-9);
+                assert(std::abs(MB.at(i, j) - P.at(k, i, j)) < 1e-12);
+            }
+        }
+    }
+}
+
+void testBatchedSingular() {
+    BatchedMatrix<double, 3> A(4);
+    for (size_t k = 0; k < 4; k++)
+        for (size_t i = 0; i < 3; i++) A.at(k, i, i) = 1.0;
+    A.at(2, 1, 1) = 0.0;
+    bool threw = false;
+    try {
+        A.getInverseMatrix();
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+}
+
+// 奇异判定与尺度无关：小尺度但良态的矩阵照常求逆，N > 4 的精确奇异矩阵照样抛出
+template <size_t N>
+void checkScaledIdentity(double scale) {
+    BatchedMatrix<double, N> A(3);
+    BatchedVector<double, N> b(3);
+    for (size_t k = 0; k < 3; k++) {
+        for (size_t i = 0; i < N; i++) {
+            A.at(k, i, i) = scale * double(k + 1);
+            b.at(k, i) = double(i + 1);
+        }
+    }
+    BatchedMatrix<double, N> inv = A.getInverseMatrix();
+    BatchedVector<double, N> x = A.solve(b);
+    for (size_t k = 0; k < 3; k++) {
+        for (size_t i = 0; i < N; i++) {
+            assert(std::abs(inv.at(k, i, i) * scale * double(k + 1) - 1.0) < 1e-12);
+            assert(std::abs(x.at(k, i) * scale * double(k + 1) - double(i + 1)) < 1e-12);
+        }
+    }
+}
+
+void testBatchedScaledSingular() {
+    checkScaledIdentity<2>(1e-6);
+    checkScaledIdentity<4>(1e-3);
+    checkScaledIdentity<6>(1e-2);
+    checkScaledIdentity<6>(1e-8);
+
+    // 第 1 个矩阵的第 5 行 = 第 0 行 + 第 1 行
+    BatchedMatrix<double, 6> S(2);
+    for (size_t k = 0; k < 2; k++)
+        for (size_t i = 0; i < 6; i++)
+            for (size_t j = 0; j < 6; j++) S.at(k, i, j) = (i == j ? 4.0 : 0.0) + std::cos(double(i * 6 + j));
+    for (size_t j = 0; j < 6; j++) S.at(1, 5, j) = S.at(1, 0, j) + S.at(1, 1, j);
+    bool threw = false;
+    try {
+        S.getInverseMatrix();
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "Batched scaled singularity test passed!" << std::endl;
+}
+
+// N > 4 走批量消元：精确零主元的矩阵行列式应为 0 而不是 0/0 = NaN
+void testBatchedSingularDeterminant() {
+    BatchedMatrix<double, 6> S(3);
+    for (size_t k = 0; k < 2; k++)
+        for (size_t i = 0; i < 6; i++)
+            for (size_t j = 0; j < 6; j++) S.at(k, i, j) = (i == j ? 4.0 : 0.0) + std::cos(double(i * 6 + j));
+    for (size_t i = 0; i < 6; i++) S.at(0, i, 0) = 0.0;  // 第 0 个矩阵：首列全 0；第 2 个矩阵：零矩阵
+    for (size_t j = 0; j < 6; j++) S.at(1, 5, j) = S.at(1, 0, j) + S.at(1, 1, j);
+    auto det = S.determinant();
+    assert(det[0] == 0.0 && S.get(0).determinant() == 0.0);
+    assert(std::isfinite(det[1]) && std::abs(det[1]) < 1e-10);
+    assert(det[2] == 0.0);
+    std::cout << "Batched singular determinant test passed!" << std::endl;
+}
+
+// 残差 ||A v - λ v|| 与正交性；包含二重根、三重根和对角矩阵
+template <size_t N>
+void checkSymmetricEigen(const BatchedMatrix<double, N>& A) {
+    auto eig = A.symmetricEigen();
+    for (size_t k = 0; k < A.size(); k++) {
+        Matrix<double> M = A.get(k);
+        for (size_t i = 0; i < N; i++)
+            for (size_t j = 0; j < i; j++) M.at(i, j) = M.at(j, i);
+        Matrix<double> V = eig.eigenvectors.get(k);
+        Matrix<double> VtV = V.transpose() * V;
+        Matrix<double> MV = M * V;
+        for (size_t c = 0; c < N; c++) {
+            if (c > 0) assert(eig.eigenvalues.at(k, c - 1) <= eig.eigenvalues.at(k, c));
+            for (size_t i = 0; i < N; i++) {
+                assert(std::abs(MV.at(i, c) - eig.eigenvalues.at(k, c) * V.at(i, c)) < 1e-12);
+                assert(std::abs(VtV.at(i, c) - (i == c ? 1.0 : 0.0)) < 1e-12);
+            }
+        }
+    }
+}
+
+void testSymmetricEigen() {
+    BatchedMatrix<double, 2> A2(3);
+    A2.at(0, 0, 0) = 2; A2.at(0, 0, 1) = 1; A2.at(0, 1, 1) = 2;
+    A2.at(1, 0, 0) = 1; A2.at(1, 1, 1) = 1;
+    A2.at(2, 0, 0) = -1; A2.at(2, 0, 1) = 3; A2.at(2, 1, 1) = 4;
+    checkSymmetricEigen(A2);
+    assert(std::abs(A2.symmetricEigen().eigenvalues.at(0, 1) - 3.0) < 1e-14);
+
+    const double dense[3][3] = {{2, -1, 0.5}, {-1, 3, 0.25}, {0.5, 0.25, -1}};
+    const double doubleRoot[3][3] = {{2, 1, 1}, {1, 2, 1}, {1, 1, 2}};  // 特征值 1, 1, 4
+    BatchedMatrix<double, 3> A3(4);
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            A3.at(0, i, j) = dense[i][j];
+            A3.at(1, i, j) = doubleRoot[i][j];
+        }
+        A3.at(2, i, i) = 5.0;        // 三重根，走 Jacobi
+        A3.at(3, i, i) = double(i);  // 已是对角阵
+    }
+    checkSymmetricEigen(A3);
+    auto eig = A3.symmetricEigen();
+    assert(std::abs(eig.eigenvalues.at(1, 0) - 1.0) < 1e-13 && std::abs(eig.eigenvalues.at(1, 2) - 4.0) < 1e-13);
+    std::cout << "Batched symmetric eigen test passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testBatch<2>();
+        testBatch<3>();
+        testBatch<4>();
+        testBatch<6>();
+        testBatchedSingular();
+        testBatchedScaledSingular();
+        testBatchedSingularDeterminant();
+        std::cout << "Batched matrix test passed!" << std::endl;
+        testSymmetricEigen();
+    } catch(const std::exception& e) {
+        std::cerr << "Test failed with error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <iostream>
+#include <cassert>
+#include <random>
+#include "BitMatrix.h"
+
+// 伪随机 0/1 矩阵，末尾 dependent 行为前面两行之和 (mod 2)，保证秩亏损
+static Matrix<long long> randomBits(size_t r, size_t c, unsigned seed, size_t dependent) {
+    Matrix<long long> M(r, c);
+    std::mt19937 gen(seed);
+    for (size_t i = 0; i < r; i++)
+        for (size_t j = 0; j < c; j++) M.at(i, j) = gen() & 1u;
+    for (size_t i = r - dependent; i < r; i++)
+        for (size_t j = 0; j < c; j++) M.at(i, j) = (M.at(i - r + dependent, j) + M.at(i / 2, j)) % 2;
+    return M;
+}
+
+void testBitMatrixBasics() {
+    // 70 列：第二个字只用了低 6 位
+    BitMatrix B(3, 70);
+    assert(B.wordsPerRow() == 2);
+    B.set(0, 0, true);
+    B.set(0, 63, true);
+    B.set(1, 64, true);
+    B.set(2, 69, true);
+    assert(B.get(0, 0) && B.get(0, 63) && B.get(1, 64) && B.get(2, 69));
+    assert(!B.get(0, 64) && !B.get(1, 63));
+    B.set(0, 63, false);
+    assert(!B.get(0, 63));
+
+    // 整数取奇偶
+    Matrix<long long> A(std::vector<std::vector<long long>>{{3, -2, 5}, {4, 7, -1}});
+    BitMatrix P(A);
+    assert(P.get(0, 0) && !P.get(0, 1) && P.get(0, 2));
+    assert(!P.get(1, 0) && P.get(1, 1) && P.get(1, 2));
+    Matrix<int> back = P.toMatrix<int>();
+    assert(back.at(0, 0) == 1 && back.at(0, 1) == 0 && back.at(1, 2) == 1);
+
+    P.xorRow(1, 0);
+    assert(P.get(1, 0) && P.get(1, 1) && !P.get(1, 2));
+
+    bool threw = false;
+    try {
+        B.get(3, 0);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "BitMatrix basics test passed!" << std::endl;
+}
+
+void testBitRREFByHand() {
+    // GF(2) 上第三行 = 第一行 + 第二行：秩 2，RREF 为 {1 0 1 1}, {0 1 1 0}
+    Matrix<long long> A(std::vector<std::vector<long long>>{{1, 1, 0, 1}, {0, 1, 1, 0}, {1, 0, 1, 1}});
+    BitRREF r((BitMatrix(A)));
+    r.toRREF();
+    assert(r.getRank() == 2);
+    assert((r.getPivotCols() == std::vector<size_t>{0, 1}));
+    const BitMatrix& R = r.getMatrix();
+    const int expected[3][4] = {{1, 0, 1, 1}, {0, 1, 1, 0}, {0, 0, 0, 0}};
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 4; j++) assert(R.get(i, j) == (expected[i][j] == 1));
+
+    // 零空间：自由列 2、3 -> (1 1 1 0)、(1 0 0 1)
+    BitMatrix K = r.getKernel();
+    assert(K.getRows() == 2 && K.getCols() == 4);
+    const int kernel[2][4] = {{1, 1, 1, 0}, {1, 0, 0, 1}};
+    for (size_t t = 0; t < 2; t++)
+        for (size_t j = 0; j < 4; j++) assert(K.get(t, j) == (kernel[t][j] == 1));
+
+    // 满秩：零空间为空
+    BitRREF full((BitMatrix(Matrix<long long>(std::vector<std::vector<long long>>{{1, 1}, {0, 1}}))));
+    assert(full.getKernel().getRows() == 0);
+    std::cout << "BitRREF hand-worked test passed!" << std::endl;
+}
+
+// 参照实现：逐元素的 GF(2) Gauss-Jordan (ModInt 只支持奇素数模)
+struct ReferenceRREF {
+    std::vector<std::vector<int>> R;
+    std::vector<size_t> pivotCols;
+};
+
+static ReferenceRREF referenceRREF(const Matrix<long long>& A) {
+    ReferenceRREF ref;
+    const size_t rows = A.getRows(), cols = A.getCols();
+    ref.R.assign(rows, std::vector<int>(cols));
+    for (size_t i = 0; i < rows; i++)
+        for (size_t j = 0; j < cols; j++) ref.R[i][j] = static_cast<int>(A.at(i, j) & 1);
+    size_t r = 0;
+    for (size_t c = 0; c < cols && r < rows; c++) {
+        size_t p = r;
+        while (p < rows && ref.R[p][c] == 0) p++;
+        if (p == rows) continue;
+        std::swap(ref.R[p], ref.R[r]);
+        for (size_t i = 0; i < rows; i++)
+            if (i != r && ref.R[i][c])
+                for (size_t j = c; j < cols; j++) ref.R[i][j] ^= ref.R[r][j];
+        ref.pivotCols.push_back(c);
+        r++;
+    }
+    return ref;
+}
+
+// 与参照实现比对：秩、主元列、最简形逐位 (GF(2) 上最简形唯一)，零空间基满足 A v = 0 (mod 2)
+static void compareWithReference(size_t r, size_t c, unsigned seed, size_t dependent) {
+    Matrix<long long> A = randomBits(r, c, seed, dependent);
+    ReferenceRREF ref = referenceRREF(A);
+    const size_t rank = ref.pivotCols.size();
+
+    BitRREF echelon((BitMatrix(A)));
+    echelon.toREF();
+    assert(echelon.getRank() == rank);
+    assert(echelon.getPivotCols() == ref.pivotCols);
+
+    BitRREF bits((BitMatrix(A)));
+    bits.toRREF();
+    assert(bits.getRank() == rank);
+    assert(rank <= r - dependent);
+    assert(bits.getPivotCols() == ref.pivotCols);
+    const BitMatrix& R = bits.getMatrix();
+    for (size_t i = 0; i < r; i++)
+        for (size_t j = 0; j < c; j++) assert(R.get(i, j) == (ref.R[i][j] == 1));
+    // 末字中 cols 之后的填充位始终为 0
+    if (c % 64 != 0)
+        for (size_t i = 0; i < r; i++) assert((R.row(i)[R.wordsPerRow() - 1] >> (c % 64)) == 0);
+
+    BitMatrix K = bits.getKernel();
+    assert(K.getRows() == c - rank);
+    for (size_t t = 0; t < K.getRows(); t++) {
+        for (size_t i = 0; i < r; i++) {
+            long long dot = 0;
+            for (size_t j = 0; j < c; j++) dot += A.at(i, j) * (K.get(t, j) ? 1 : 0);
+            assert(dot % 2 == 0);
+        }
+    }
+}
+
+void testBitRREFAgainstReference() {
+    compareWithReference(5, 7, 1, 1);
+    compareWithReference(20, 64, 2, 3);     // 恰好一个整字
+    compareWithReference(40, 70, 3, 5);     // 末字只用 6 位
+    compareWithReference(70, 129, 4, 10);   // 三个字，末字只用 1 位
+    compareWithReference(150, 100, 5, 60);  // 行多于列，跨多个 M4RI 块
+    std::cout << "BitRREF vs reference GF(2) elimination test passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testBitMatrixBasics();
+        testBitRREFByHand();
+        testBitRREFAgainstReference();
+    } catch(const std::exception& e) {
+        std::cerr << "Test failed with error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <string>
+#include "matrix.h"
+#include "DoubleDouble.h"
+
+void testDefectiveExp() {
+    // 不可对角化的幂零矩阵：e^N = I + N + N^2 / 2
+    Matrix<double> N(std::vector<std::vector<double>>{{0, 1, 0}, {0, 0, 1}, {0, 0, 0}});
+    Matrix<double> E = N.exp();
+    const double expected[3][3] = {{1, 1, 0.5}, {0, 1, 1}, {0, 0, 1}};
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 3; j++) assert(std::abs(E.at(i, j) - expected[i][j]) < 1e-15);
+    std::cout << "Defective matrix exponential test passed!" << std::endl;
+}
+
+void testRotationExp() {
+    // 覆盖低阶 Padé (小范数) 与缩放-平方 (大范数) 两条路径
+    for (double t : {0.01, 0.5, 2.0, 10.0, 100.0}) {
+        Matrix<double> R(std::vector<std::vector<double>>{{0, -t}, {t, 0}});
+        Matrix<double> E = R.exp();
+        assert(std::abs(E.at(0, 0) - std::cos(t)) < 1e-13);
+        assert(std::abs(E.at(1, 0) - std::sin(t)) < 1e-13);
+        assert(std::abs(E.at(0, 1) + std::sin(t)) < 1e-13);
+    }
+
+    const size_t n = 30;
+    Matrix<double> A(n, n);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < n; j++) A.at(i, j) = std::sin(double(i * n + j)) * 0.8;
+    Matrix<double> P = A.exp() * (A * -1.0).exp();
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < n; j++) assert(std::abs(P.at(i, j) - (i == j ? 1.0 : 0.0)) < 1e-10);
+
+    // double-double 下额外缩放，误差到 1e-30 量级
+    using D = DoubleDouble;
+    Matrix<D> G(std::vector<std::vector<D>>{{D(0), D(-1)}, {D(1), D(0)}});
+    Matrix<D> Ed = G.exp();
+    assert(abs(Ed.at(0, 0) * Ed.at(0, 0) + Ed.at(1, 0) * Ed.at(1, 0) - D(1)) < D(1e-30));
+    assert(Ed.at(1, 0).toString(28) == "8.414709848078965066525023216e-1");  // sin(1)
+    std::cout << "Matrix exponential test passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testDefectiveExp();
+        testRotationExp();
+    } catch(const std::exception& e) {
+        std::cerr << "Test failed with error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
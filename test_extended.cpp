@@ -0,0 +1,290 @@
+#include <iostream>
+#include <cassert>
+#include "DoubleDouble.h"
+#include "Rational.h"
+#include "matrix.h"
+#include "RREF.h"
+#include "SolvingEquation.h"
+
+void testDoubleDoubleArithmetic() {
+    using D = DoubleDouble;
+    D s = sqrt(D(2));
+    assert(abs(s * s - D(2)) < D(1e-30));
+    D third = D(1) / D(3);
+    assert(abs(third * D(3) - D(1)) < D(1e-31));
+    assert(abs(log(exp(D(1.5))) - D(1.5)) < D(1e-30));
+    assert(D(9007199254740993LL) - D(9007199254740992LL) == D(1));  // 2^53 + 1 精确
+    std::cout << "Double-double arithmetic test passed!" << std::endl;
+}
+
+// Hilbert 矩阵的逆与精确有理数结果的最大相对误差
+template <typename T>
+long double hilbertInverseError(size_t n) {
+    Matrix<T> H(n, n);
+    Matrix<Rational<>> R(n, n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            H.at(i, j) = T(1) / T(static_cast<int>(i + j + 1));
+            R.at(i, j) = Rational<>(BigInt(1), BigInt(static_cast<long long>(i + j + 1)));
+        }
+    }
+    Matrix<T> Hinv = H.getInverseMatrix();
+    Matrix<Rational<>> Rinv = R.getInverseMatrix();
+    long double maxErr = 0;
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            long double exact = static_cast<long double>(Rinv.at(i, j));
+            long double err = (static_cast<long double>(Hinv.at(i, j)) - exact) / exact;
+            maxErr = std::max(maxErr, err < 0 ? -err : err);
+        }
+    }
+    return maxErr;
+}
+
+void testIllConditionedInverse() {
+    // Hilbert-14 条件数约 1e19，double 下会被判为奇异
+    bool threw = false;
+    try {
+        hilbertInverseError<double>(14);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(hilbertInverseError<DoubleDouble>(14) < 1e-8);
+#ifdef __SIZEOF_FLOAT128__
+    assert(hilbertInverseError<__float128>(14) < 1e-10);
+#endif
+    std::cout << "Ill-conditioned inverse test passed!" << std::endl;
+}
+
+void testExtendedEigen() {
+    using D = DoubleDouble;
+    Matrix<D> S(std::vector<std::vector<D>>{{D(2), D(1), D(0)}, {D(1), D(3), D(1)}, {D(0), D(1), D(4)}});
+    auto eig = S.eigen();
+    assert(eig.eigenvalues.size() == 3);
+    for (size_t k = 0; k < 3; k++) {
+        Vector<D> r = S * eig.eigenvectors[k] - eig.eigenvectors[k] * eig.eigenvalues[k];
+        assert(r.normInf() < D(1e-25));
+    }
+    auto ld = S.logAbsDeterminant();
+    assert(ld.sign == 1 && abs(ld.logAbs - log(D(18))) < D(1e-28));
+    std::cout << "Extended precision eigen test passed!" << std::endl;
+}
+
+void testLogAbsDeterminant() {
+    // 非对称、奇置换：走部分主元 LU，符号为负
+    Matrix<double> A(std::vector<std::vector<double>>{
+        {0, 2, 1, 0, 0}, {3, 0, 0, 1, 0}, {0, 1, 0, 0, 4}, {1, 0, 5, 0, 0}, {0, 0, 0, 6, 1}});
+    assert(!A.isSymmetric());
+    double det = A.determinant();
+    assert(det < 0);
+    auto ld = A.logAbsDeterminant();
+    assert(ld.sign == -1 && std::abs(ld.logAbs - std::log(-det)) < 1e-12);
+
+    // 奇异：返回 {0, -inf}
+    Matrix<double> S(std::vector<std::vector<double>>{{1, 2, 3}, {1, 2, 3}, {4, 5, 7}});
+    auto ls = S.logAbsDeterminant();
+    assert(ls.sign == 0 && std::isinf(ls.logAbs) && ls.logAbs < 0);
+
+    // 400 阶上三角 (对角 ±10，偶数个负号)：|det| = 10^400 上溢为 inf，log|det| = 400 ln 10
+    const size_t n = 400;
+    Matrix<double> U(n, n);
+    for (size_t i = 0; i < n; i++) {
+        U.at(i, i) = (i % 2 == 0) ? 10.0 : -10.0;
+        for (size_t j = i + 1; j < n; j++) U.at(i, j) = std::sin(double(i + 2 * j));
+    }
+    assert(std::isinf(U.determinant()));
+    auto lu = U.logAbsDeterminant();
+    assert(lu.sign == 1 && std::abs(lu.logAbs - n * std::log(10.0)) < 1e-9);
+
+    // 200 阶 1e-3 * I：det = 1e-600 下溢为 0，Cholesky 路径给出 200 ln 1e-3
+    Matrix<double> D(200, 200);
+    for (size_t i = 0; i < 200; i++) D.at(i, i) = 1e-3;
+    assert(D.determinant() == 0.0);
+    auto ldd = D.logAbsDeterminant();
+    assert(ldd.sign == 1 && std::abs(ldd.logAbs - 200 * std::log(1e-3)) < 1e-9);
+
+    // 整数矩阵：Cholesky / LU 的整数除法会截断，需经 Bareiss 的精确行列式取对数
+    Matrix<long long> Ai = A.cast<long long>();
+    long long deti = Ai.determinant();
+    auto ldi = Ai.logAbsDeterminant();
+    assert(deti == static_cast<long long>(std::llround(det)));
+    assert(ldi.sign == -1 && std::abs(ldi.logAbs - std::log(static_cast<long double>(-deti))) < 1e-15);
+    Matrix<long long> P(std::vector<std::vector<long long>>{
+        {4, 1, 0, 0, 0}, {1, 5, 2, 0, 0}, {0, 2, 6, 1, 0}, {0, 0, 1, 3, 1}, {0, 0, 0, 1, 2}});
+    long long detp = P.determinant();
+    auto lp = P.logAbsDeterminant();
+    assert(P.isSymmetric() && detp > 0);
+    assert(lp.sign == 1 && std::abs(lp.logAbs - std::log(static_cast<long double>(detp))) < 1e-15);
+    auto lsi = S.cast<long long>().logAbsDeterminant();
+    assert(lsi.sign == 0 && std::isinf(lsi.logAbs) && lsi.logAbs < 0);
+    // BigInt：30 阶对角 -10 与一个 10^31 量级的元素，行列式超出 long long
+    Matrix<BigInt> Bg(30, 30);
+    for (size_t i = 0; i < 30; i++) Bg.at(i, i) = BigInt(-10);
+    Bg.at(0, 0) = BigInt(std::string("10000000000000000000000000000000"));
+    auto lb = Bg.logAbsDeterminant();
+    assert(lb.sign == -1 && std::abs(lb.logAbs - 60 * std::log(10.0L)) < 1e-13);
+    std::cout << "Log-determinant test passed!" << std::endl;
+}
+
+void testLUInverse() {
+    // 对角元很小，每一步都要换行；n > 64 时逆矩阵各行分块并行回代
+    const size_t n = 150;
+    Matrix<double> A(n, n);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < n; j++) A.at(i, j) = (i == j) ? 1e-3 : std::sin(double(3 * i + 7 * j + 1));
+    Matrix<double> serial;
+    for (size_t c : {1, 4}) {
+        setParallelConcurrency(c);
+        Matrix<double> inv = A.getInverseMatrix();
+        Matrix<double> I = A * inv;
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++) assert(std::abs(I.at(i, j) - (i == j ? 1.0 : 0.0)) < 1e-9);
+        if (c == 1) serial = inv;
+        else
+            for (size_t i = 0; i < n; i++)
+                for (size_t j = 0; j < n; j++) assert(inv.at(i, j) == serial.at(i, j));
+    }
+    setParallelConcurrency(0);
+
+    // 元素量级 1e-10 的良态矩阵：奇异判定随矩阵尺度缩放，4 阶 (闭式) 与 5 阶 (LU) 行为一致
+    for (size_t m : {4, 5}) {
+        Matrix<double> S(m, m);
+        for (size_t i = 0; i < m; i++)
+            for (size_t j = 0; j < m; j++) S.at(i, j) = 1e-10 * ((i == j ? 4.0 : 0.0) + std::cos(double(i + 2 * j)));
+        Matrix<double> I = S * S.getInverseMatrix();
+        for (size_t i = 0; i < m; i++)
+            for (size_t j = 0; j < m; j++) assert(std::abs(I.at(i, j) - (i == j ? 1.0 : 0.0)) < 1e-12);
+    }
+    std::cout << "LU inverse test passed!" << std::endl;
+}
+
+// ||b - A x||_inf / (||A||_inf ||x||_inf + ||b||_inf)，残差用 long double 计算
+static double backwardError(const Matrix<double>& A, const Vector<double>& x, const Matrix<double>& b) {
+    const size_t n = A.getRows();
+    double r = 0, normX = 0, normB = 0;
+    for (size_t i = 0; i < n; i++) {
+        long double acc = b.at(i, 0);
+        for (size_t j = 0; j < n; j++) acc -= static_cast<long double>(A.at(i, j)) * x[j];
+        r = std::max(r, static_cast<double>(std::fabs(acc)));
+        normX = std::max(normX, std::abs(x[i]));
+        normB = std::max(normB, std::abs(b.at(i, 0)));
+    }
+    return r / (A.normInf() * normX + normB);
+}
+
+void testMixedPrecisionSolve() {
+    using SE = SolvingEquation<double>;
+    const double unitRoundoff = std::numeric_limits<double>::epsilon();
+
+    // 良态 (对角占优) 40 阶：float 分解 + 迭代精化达到 double 的后向误差，而 float 单独求解只有 1e-7 量级
+    const size_t n = 40;
+    Matrix<double> A(n, n), b(n, 1);
+    for (size_t i = 0; i < n; i++) {
+        b.at(i, 0) = std::sin(double(i) + 0.5);
+        for (size_t j = 0; j < n; j++) A.at(i, j) = std::cos(double(7 * i + 3 * j)) + (i == j ? double(n) : 0.0);
+    }
+    SE mixed(A, b, SE::SolveMethod::MixedPrecision);
+    assert(mixed.getSolutionType() == SE::SolutionType::UniqueSolution);
+    assert(mixed.isRefined());
+    mixed.computeSolution();
+    assert(backwardError(A, mixed.getParticularSolution(), b) <= 4 * unitRoundoff);
+    Vector<double> low = A.cast<float>().luDecomposition(0.0f).solve(b.getCol(0).cast<float>()).cast<double>();
+    assert(backwardError(A, low, b) > 1e3 * unitRoundoff);
+
+    SE elimination(A, b);
+    elimination.computeSolution();
+    for (size_t i = 0; i < n; i++)
+        assert(std::abs(mixed.getParticularSolution()[i] - elimination.getParticularSolution()[i]) < 1e-13);
+
+    // 病态方程组退回 double LU：结果与直接 double LU 逐位相同
+    // 参照解不设主元阈值：1e39 的行会使默认的相对阈值把 O(1) 的主元判为奇异，而 MixedPrecision 按行取尺度
+    auto checkFallback = [](const Matrix<double>& H, const Matrix<double>& c) {
+        SE fallback(H, c, SE::SolveMethod::MixedPrecision);
+        assert(fallback.getSolutionType() == SE::SolutionType::UniqueSolution);
+        assert(!fallback.isRefined());
+        Vector<double> direct = H.luDecomposition(0.0).solve(c.getCol(0));
+        for (size_t i = 0; i < H.getRows(); i++) assert(fallback.getParticularSolution()[i] == direct[i]);
+        assert(backwardError(H, fallback.getParticularSolution(), c) < 1e-15);
+    };
+
+    // 1000 * Hilbert-9，条件数约 5e11 > 1 / eps_float：float 分解非奇异，但修正量不收缩
+    const size_t h = 9;
+    Matrix<double> H(h, h), c(h, 1);
+    for (size_t i = 0; i < h; i++) {
+        c.at(i, 0) = 1.0;
+        for (size_t j = 0; j < h; j++) H.at(i, j) = 1e3 / double(i + j + 1);
+    }
+    checkFallback(H, c);
+
+    // 最后两行只差 1e-8：转成 float 后两行相同，float 分解直接判为奇异
+    const size_t g = 8;
+    Matrix<double> G(g, g), d(g, 1);
+    for (size_t i = 0; i < g; i++) {
+        d.at(i, 0) = double(i + 1);
+        for (size_t j = 0; j < g; j++) G.at(i, j) = std::cos(double(5 * i + 2 * j)) + (i == j ? 4.0 : 0.0);
+    }
+    for (size_t j = 0; j < g; j++) G.at(g - 1, j) = G.at(g - 2, j) + (j == g - 1 ? 1e-8 : 0.0);
+    checkFallback(G, d);
+
+    // 元素 1e39 超出 float 范围：不做 float 分解，直接退回 double LU，结果与 Elimination 一致
+    const size_t m = 6;
+    Matrix<double> B(m, m), e(m, 1);
+    for (size_t i = 0; i < m; i++) {
+        e.at(i, 0) = std::cos(double(i));
+        for (size_t j = 0; j < m; j++) B.at(i, j) = std::sin(double(3 * i + j)) + (i == j ? 3.0 : 0.0);
+    }
+    B.at(0, 0) = 1e39;
+    checkFallback(B, e);
+    SE big(B, e, SE::SolveMethod::MixedPrecision), bigElimination(B, e);
+    bigElimination.computeSolution();
+    for (size_t i = 0; i < m; i++) {
+        double xi = big.getParticularSolution()[i], yi = bigElimination.getParticularSolution()[i];
+        assert(std::isfinite(xi) && std::abs(xi - yi) <= 1e-12 * std::max(1.0, std::abs(yi)));
+    }
+
+    // 秩亏但相容：第 4 行 = 第 0 行 + 第 1 行，b 同样相加；残差很小但不是唯一解，须与 Elimination 一样判为无穷多解
+    const size_t r = 5;
+    Matrix<double> R(r, r), f(r, 1);
+    for (size_t i = 0; i < r - 1; i++) {
+        f.at(i, 0) = std::sin(double(2 * i + 1));
+        for (size_t j = 0; j < r; j++) R.at(i, j) = std::cos(double(7 * i + 3 * j)) + (i == j ? 2.0 : 0.0);
+    }
+    for (size_t j = 0; j < r; j++) R.at(r - 1, j) = R.at(0, j) + R.at(1, j);
+    f.at(r - 1, 0) = f.at(0, 0) + f.at(1, 0);
+    SE deficient(R, f, SE::SolveMethod::MixedPrecision), deficientElimination(R, f);
+    assert(deficientElimination.getSolutionType() == SE::SolutionType::InfiniteSolutions);
+    assert(deficient.getSolutionType() == SE::SolutionType::InfiniteSolutions);
+    assert(!deficient.isRefined());
+    deficient.computeSolution();
+    assert(!deficient.getNullspaceBasis().empty());
+    assert(backwardError(R, deficient.getParticularSolution(), f) < 1e-12);
+
+    // luDecomposition 的默认奇异阈值相对 max|a_ij|：1e-12 * (良态矩阵) 可分解，秩亏矩阵整体放大 1e12 仍判为奇异
+    Matrix<double> tiny = A * 1e-12, hugeDeficient = R * 1e12;
+    Vector<double> tinyX = tiny.luDecomposition().solve(b.getCol(0));
+    assert(backwardError(tiny, tinyX, b) < 1e-14);
+    bool threw = false;
+    try {
+        hugeDeficient.luDecomposition();
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "Mixed-precision solve test passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testDoubleDoubleArithmetic();
+        testIllConditionedInverse();
+        testExtendedEigen();
+        testLogAbsDeterminant();
+        testLUInverse();
+        testMixedPrecisionSolve();
+    } catch(const std::exception& e) {
+        std::cerr << "Test failed with error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,211 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <random>
+#include "BigInt.h"
+#include "Rational.h"
+#include "matrix.h"
+#include "RREF.h"
+#include "MultiModular.h"
+
+void testBareissDeterminant() {
+    // 旧实现用截断整数除法消元，这个矩阵会得到错误结果；正确值为 10
+    Matrix<long long> A(std::vector<std::vector<long long>>{{2, 3, 1}, {4, 1, 5}, {3, 2, 2}});
+    assert(A.determinant() == 10);
+
+    Matrix<long long> S(std::vector<std::vector<long long>>{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+    assert(S.determinant() == 0);
+    std::cout << "Bareiss determinant test passed!" << std::endl;
+}
+
+void testFractionFreeRREF() {
+    // 整数 RREF 结果为 d * RREF(A)，核基向量为整数向量
+    Matrix<long long> A(std::vector<std::vector<long long>>{{2, 4, 1, 3}, {1, 2, 1, 1}, {3, 6, 2, 4}});
+    RREF<long long> r(A);
+    r.toRREF();
+    assert(r.getRank() == 2);
+    assert(r.getPivotCols() == std::vector<size_t>({0, 2}));
+
+    for (const auto& v : r.getKernel()) {
+        Vector<long long> y = A * v;
+        for (size_t i = 0; i < y.size(); i++) assert(y[i] == 0);
+    }
+    std::cout << "Fraction-free RREF test passed!" << std::endl;
+}
+
+void testBigIntDeterminant() {
+    // 元素为 1e12 量级时 long long 乘积溢出，BigInt 下仍精确
+    Matrix<BigInt> A(2, 2);
+    A.at(0, 0) = BigInt(1000000000000LL); A.at(0, 1) = BigInt(3);
+    A.at(1, 0) = BigInt(7);               A.at(1, 1) = BigInt(1000000000000LL);
+    assert(A.determinant() == BigInt("999999999999999999999979"));
+    std::cout << "BigInt determinant test passed!" << std::endl;
+}
+
+void testMultiModular() {
+    // CRT 重建结果应与 Bareiss 一致，且秩不受小素数巧合影响
+    const size_t n = 12;
+    Matrix<long long> A(n, n);
+    Matrix<BigInt> B(n, n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            long long v = static_cast<long long>((i * 7919 + j * 104729 + i * j * 31) % 2000003) - 1000000;
+            A.at(i, j) = v;
+            B.at(i, j) = BigInt(v);
+        }
+    }
+    BigInt exact = B.determinant();
+    assert(MultiModular::determinant(A) == exact);
+    assert(MultiModular::determinant(A, true) == exact);
+    assert(MultiModular::rank(A) == static_cast<size_t>(B.rank()));
+
+    Matrix<long long> S(std::vector<std::vector<long long>>{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+    assert(MultiModular::determinant(S) == BigInt(0));
+    assert(MultiModular::rank(S) == 2);
+
+    // 窄整数类型：先提升到 64 位再取模，2^26 附近的素数不会被截断
+    Matrix<short> N(std::vector<std::vector<short>>{{3, -7, 2}, {5, 1, -4}, {-2, 6, 9}});
+    assert(MultiModular::determinant(N) == BigInt(N.cast<long long>().determinant()));
+    assert(MultiModular::rank(N) == 3);
+    Matrix<unsigned char> U(std::vector<std::vector<unsigned char>>{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+    assert(MultiModular::rank(U) == 2);
+    std::cout << "Multi-modular determinant test passed!" << std::endl;
+}
+
+void testMatrixPower() {
+    // Fibonacci：[[1,1],[1,0]]^k 的 (0,1) 元为 F(k)，BigInt 保证不溢出
+    Matrix<BigInt> F(std::vector<std::vector<BigInt>>{{BigInt(1), BigInt(1)}, {BigInt(1), BigInt(0)}});
+    assert(F.pow(200).at(0, 1) == BigInt("280571172992510140037611932413038677189525"));
+    assert(F.pow(1).at(0, 0) == BigInt(1));
+    assert(F.pow(0).at(0, 1) == BigInt(0) && F.pow(0).at(1, 1) == BigInt(1));
+
+    // 随机游走转移矩阵的高次幂收敛到平稳分布，行和保持为 1
+    Matrix<double> P(std::vector<std::vector<double>>{{0.5, 0.5, 0}, {0.25, 0.5, 0.25}, {0, 0.5, 0.5}});
+    Matrix<double> Pk = P.pow(1000000);
+    for (size_t i = 0; i < 3; i++) {
+        assert(std::abs(Pk.at(i, 0) - 0.25) < 1e-12);
+        assert(std::abs(Pk.at(i, 1) - 0.5) < 1e-12);
+    }
+
+    // 对称矩阵经缓存的对角化求幂，与快速幂一致
+    Matrix<double> S(std::vector<std::vector<double>>{{2, 1}, {1, 2}});
+    auto diag = S.diagonalize();
+    for (unsigned long long k : {3ULL, 10ULL}) {
+        Matrix<double> a = S.pow(k, diag), b = S.pow(k);
+        for (size_t i = 0; i < 2; i++)
+            for (size_t j = 0; j < 2; j++) assert(std::abs(a.at(i, j) - b.at(i, j)) < 1e-9 * std::abs(b.at(i, j)));
+    }
+    std::cout << "Matrix power test passed!" << std::endl;
+}
+
+void testCharacteristicPolynomial() {
+    // det(λI - A) = λ^3 - 9λ^2 + 24λ - 18
+    Matrix<long long> A(std::vector<std::vector<long long>>{{2, 1, 0}, {1, 3, 1}, {0, 1, 4}});
+    const std::vector<long long> expected = {-18, 24, -9, 1};
+    assert(A.characteristicPolynomial() == expected);
+
+    std::vector<double> pd = A.cast<double>().characteristicPolynomial();
+    for (size_t k = 0; k < expected.size(); k++) assert(std::abs(pd[k] - expected[k]) < 1e-12);
+
+    // Berkowitz (BigInt) 与精确域 Hessenberg + Hyman 递推 (Rational) 逐项一致，常数项为 (-1)^n det
+    const size_t n = 15;
+    Matrix<BigInt> B(n, n);
+    Matrix<Rational<>> R(n, n);
+    std::mt19937 gen(5);
+    std::uniform_int_distribution<long long> dist(-9, 9);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            long long v = dist(gen);
+            B.at(i, j) = BigInt(v);
+            R.at(i, j) = Rational<>(v);
+        }
+    }
+    std::vector<BigInt> pb = B.characteristicPolynomial();
+    std::vector<Rational<>> pr = R.characteristicPolynomial();
+    for (size_t k = 0; k <= n; k++) assert(Rational<>(pb[k]) == pr[k]);
+    assert(pb[0] == -B.determinant());
+
+    // 迹与行列式相同但特征多项式不同
+    Matrix<long long> P(std::vector<std::vector<long long>>{{1, 0, 0}, {0, 1, 0}, {0, 0, 4}});
+    Matrix<long long> Q(std::vector<std::vector<long long>>{{2, 0, 0}, {0, 2, 0}, {0, 0, 1}});
+    assert(!P.isPossiblySimilarTo(Q));
+    // 特征多项式只是必要条件：Jordan 块与对角阵无法区分
+    Matrix<long long> S(std::vector<std::vector<long long>>{{1, 1, 0}, {0, 1, 0}, {0, 0, 4}});
+    assert(P.isPossiblySimilarTo(S));
+
+    // 浮点相似变换：两者行列式末位不同，特征多项式在容差内一致
+    Matrix<double> F(std::vector<std::vector<double>>{
+        {4, 1, 0, 2, 1}, {1, 3, 1, 0, 0}, {0, 2, 5, 1, 3}, {1, 0, 1, 2, 1}, {2, 1, 0, 1, 6}});
+    Matrix<double> T(std::vector<std::vector<double>>{
+        {1, 0.5, 0, 0, 0.25}, {0, 1, 0.3, 0, 0}, {0.2, 0, 1, 0.7, 0}, {0, 0, 0.1, 1, 0.4}, {0.6, 0, 0, 0, 1}});
+    Matrix<double> G = F.similarityTransform(T);
+    assert(F.isPossiblySimilarTo(G));
+    Matrix<double> H = F;
+    H.at(0, 0) += 1e-3;
+    assert(!F.isPossiblySimilarTo(H));
+
+    // 特征值 ± 成对：奇次项系数应为 0，计算值只是舍入噪声，容差须随 ||A||^(n-k) 缩放
+    std::uniform_real_distribution<double> entry(-1.0, 1.0);
+    for (size_t m : {8, 10}) {
+        for (int trial = 0; trial < 20; trial++) {
+            Matrix<double> D(m, m), P(m, m);
+            for (size_t i = 0; i < m; i++) {
+                D.at(i, i) = (i % 2 == 0 ? 1.0 : -1.0) * double(5 + i / 2);
+                for (size_t j = 0; j < m; j++) P.at(i, j) = entry(gen) + (i == j ? 2.0 : 0.0);
+            }
+            assert(D.isPossiblySimilarTo(P.getInverseMatrix() * D * P));
+        }
+    }
+    Matrix<double> E = Matrix<double>::identity(10);
+    for (size_t i = 0; i < 10; i++) E.at(i, i) = (i % 2 == 0 ? 1.0 : -1.0) * double(5 + i / 2);
+    Matrix<double> E2 = E;
+    E2.at(9, 9) += 0.1;
+    assert(!E.isPossiblySimilarTo(E2));
+    std::cout << "Characteristic polynomial test passed!" << std::endl;
+}
+
+void testCharacteristicPolynomialOverflow() {
+    // 常数项为 1e6^14 = 1e84，远超 long long：与 determinant() 一样抛出而非返回截断值
+    const size_t n = 14;
+    Matrix<long long> A(n, n);
+    for (size_t i = 0; i < n; i++) {
+        A.at(i, i) = 1000000;
+        if (i + 1 < n) A.at(i, i + 1) = 1;
+    }
+    bool threw = false;
+    try {
+        A.characteristicPolynomial();
+    } catch (const std::overflow_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    threw = false;
+    try {
+        A.determinant();
+    } catch (const std::overflow_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // 不溢出的小矩阵结果不变：det(λI - 2I) = (λ - 2)^2
+    Matrix<long long> B(std::vector<std::vector<long long>>{{2, 0}, {0, 2}});
+    assert(B.characteristicPolynomial() == (std::vector<long long>{4, -4, 1}));
+    std::cout << "Characteristic polynomial overflow test passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testBareissDeterminant();
+        testFractionFreeRREF();
+        testBigIntDeterminant();
+        testMultiModular();
+        testMatrixPower();
+        testCharacteristicPolynomial();
+        testCharacteristicPolynomialOverflow();
+    } catch(const std::exception& e) {
+        std::cerr << "Test failed with error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
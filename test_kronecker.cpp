@@ -0,0 +1,94 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include "Kronecker.h"
+
+void testKroneckerProduct() {
+    Matrix<double> A(std::vector<std::vector<double>>{{4, 1, 0}, {1, 3, 1}, {0, 2, 5}});
+    Matrix<double> B(std::vector<std::vector<double>>{{2, 1}, {0.5, 3}});
+    KroneckerProduct<double> K(A, B);
+    Matrix<double> full = K.toMatrix();
+    assert(full.getRows() == 6 && full.at(1, 3) == A.at(0, 1) * B.at(1, 1));
+
+    Vector<double> x(6);
+    for (size_t i = 0; i < 6; i++) x[i] = static_cast<double>(i) - 2.5;
+    assert(((K * x) - full * x).norm() < 1e-13);
+
+    Vector<double> b = full * x;
+    assert((K.solve(b) - x).norm() < 1e-12);
+
+    // 良态但整体很小的因子 (1e-10 I ⊗ 1e-10 B)：奇异判定相对于因子量级，不能按绝对阈值判为奇异
+    KroneckerProduct<double> Ks(Matrix<double>::identity(3) * 1e-10, B * 1e-10);
+    Vector<double> bs = Ks.toMatrix() * x;
+    assert((Ks.solve(bs) - x).norm() < 1e-12);
+
+    // 非方阵因子也能做矩阵-向量乘积
+    Matrix<double> R(std::vector<std::vector<double>>{{1, 2, 0}, {0, 1, 3}});
+    KroneckerProduct<double> KR(R, B);
+    Vector<double> y(6, 1.0);
+    assert(((KR * y) - KR.toMatrix() * y).norm() < 1e-13);
+    std::cout << "Kronecker product test passed!" << std::endl;
+}
+
+void testKroneckerSum() {
+    // 二维 Poisson 方程 (L ⊕ L) u = f，L 为一维二阶差分
+    const size_t n = 24;
+    Matrix<double> L(n, n);
+    for (size_t i = 0; i < n; i++) {
+        L.at(i, i) = -2;
+        if (i > 0) L.at(i, i - 1) = 1;
+        if (i + 1 < n) L.at(i, i + 1) = 1;
+    }
+    KroneckerSum<double> S(L, L);
+    Vector<double> f(n * n);
+    for (size_t i = 0; i < n * n; i++) f[i] = std::sin(0.3 * i) + 1;
+    Vector<double> u = S.solve(f);
+    assert((S * u - f).norm() < 1e-10 * f.norm());
+
+    // 非对称因子走 Sylvester 求解器；与显式展开的矩阵对照
+    Matrix<double> N(std::vector<std::vector<double>>{{1, 2}, {0, 3}});
+    Matrix<double> M(std::vector<std::vector<double>>{{2, 1, 0}, {1, 2, 1}, {0, 1, 2}});
+    KroneckerSum<double> T2(N, M);
+    Vector<double> g(6, 1.0);
+    Vector<double> v = T2.solve(g);
+    assert((T2.toMatrix() * v - g).norm() < 1e-10);
+    assert(((T2 * v) - T2.toMatrix() * v).norm() < 1e-12);
+
+    // 迎风格式的对流扩散算子 (对角 -2，下 1.5，上 0.5)：特征值互异但特征向量病态，一般对角化会失败
+    Matrix<double> D(n, n);
+    for (size_t i = 0; i < n; i++) {
+        D.at(i, i) = -2;
+        if (i > 0) D.at(i, i - 1) = 1.5;
+        if (i + 1 < n) D.at(i, i + 1) = 0.5;
+    }
+    KroneckerSum<double> CD(D, D);
+    Vector<double> w = CD.solve(f);
+    assert((CD * w - f).norm() < 1e-10 * f.norm());
+
+    // 整体缩小 1e-10 的算子：对称性与奇异判定都相对于因子的量级
+    for (bool symmetric : {true, false}) {
+        Matrix<double> Ls = L * 1e-10;
+        if (!symmetric) Ls.at(3, 4) *= 1.5;
+        KroneckerSum<double> Ks(Ls, Ls);
+        Vector<double> us = Ks.solve(f);
+        assert((Ks * us - f).norm() < 1e-10 * f.norm());
+    }
+
+    // 因子有复特征值 1 ± 2i：实 Schur 形中为 2x2 块
+    Matrix<double> Rot(std::vector<std::vector<double>>{{1, -2}, {2, 1}});
+    KroneckerSum<double> T3(Rot, M);
+    Vector<double> z = T3.solve(g);
+    assert((T3.toMatrix() * z - g).norm() < 1e-10);
+    std::cout << "Kronecker sum test passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testKroneckerProduct();
+        testKroneckerSum();
+    } catch(const std::exception& e) {
+        std::cerr << "Test failed with error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
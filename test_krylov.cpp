@@ -0,0 +1,83 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <random>
+#include "Krylov.h"
+
+static double relErr(const Vector<double>& a, const Vector<double>& b) { return (a - b).norm() / b.norm(); }
+
+void testDenseKrylov() {
+    const size_t n = 80;
+    Matrix<double> A(n, n);
+    Vector<double> v(n);
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> dist(-0.5, 0.5);
+    auto rnd = [&]() { return dist(gen); };
+    for (size_t i = 0; i < n; i++) {
+        v[i] = rnd();
+        for (size_t j = 0; j < n; j++) A.at(i, j) = rnd() * 0.4;
+    }
+
+    KrylovExpm<double> K(A, v, 1e-12, 30);
+    for (double t : {1.0, 0.25, -2.0, 20.0}) {
+        Vector<double> expected = (A * t).exp() * v;
+        assert(relErr(K.apply(t), expected) < 1e-11);
+    }
+
+    // 基与 t 无关：较小的 t 直接复用已有的子空间，不再做矩阵-向量乘积
+    size_t used = K.matvecCount();
+    K.apply(std::vector<double>{0.1, 0.5, 0.9});
+    assert(K.matvecCount() == used);
+    std::cout << "Dense Krylov expmv test passed!" << std::endl;
+}
+
+void testOperatorKrylov() {
+    // 一维 Laplace 算子只以矩阵-向量乘积的形式给出 (对称，走 Lanczos)
+    const size_t n = 200;
+    auto laplace = [n](const Vector<double>& x) {
+        Vector<double> y(n);
+        for (size_t i = 0; i < n; i++) {
+            double s = -2 * x[i];
+            if (i > 0) s += x[i - 1];
+            if (i + 1 < n) s += x[i + 1];
+            y[i] = 100 * s;
+        }
+        return y;
+    };
+    Matrix<double> L(n, n);
+    for (size_t i = 0; i < n; i++) {
+        L.at(i, i) = -200;
+        if (i > 0) L.at(i, i - 1) = 100;
+        if (i + 1 < n) L.at(i, i + 1) = 100;
+    }
+    Vector<double> v(n);
+    for (size_t i = 0; i < n; i++) v[i] = std::sin(0.05 * i) + (i % 9 == 0 ? 1.0 : 0.0);
+
+    KrylovExpm<double> K(laplace, v, 1e-12, 40, true);
+    for (double t : {1e-3, 0.05}) assert(relErr(K.apply(t), (L * t).exp() * v) < 1e-10);
+
+    // 幂零矩阵：Krylov 子空间在 3 维处不变，结果精确
+    Matrix<double> N(std::vector<std::vector<double>>{{0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}});
+    KrylovExpm<double> KN(N, Vector<double>(std::vector<double>{0, 0, 1, 0}));
+    Vector<double> r = KN.apply(2.0);
+    assert(KN.isInvariant() && KN.dimension() == 3);
+    assert(std::abs(r[0] - 2.0) < 1e-14 && std::abs(r[1] - 2.0) < 1e-14 && std::abs(r[2] - 1.0) < 1e-14);
+
+    // 元素都在 1e-10 量级的非对称矩阵：绝对容差会把它当作对称矩阵走 Lanczos 三项递推
+    Matrix<double> S(std::vector<std::vector<double>>{{1e-10, 5e-10, 0}, {0, 2e-10, 3e-10}, {0, 0, 1e-10}});
+    Vector<double> ones(3, 1.0);
+    KrylovExpm<double> KS(S, ones);
+    assert(relErr(KS.apply(1e10), (S * 1e10).exp() * ones) < 1e-11);
+    std::cout << "Operator Krylov expmv test passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testDenseKrylov();
+        testOperatorKrylov();
+    } catch(const std::exception& e) {
+        std::cerr << "Test failed with error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
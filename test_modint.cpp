@@ -0,0 +1,72 @@
+#include <iostream>
+#include <cassert>
+#include "ModInt.h"
+#include "matrix.h"
+#include "RREF.h"
+#include "SolvingEquation.h"
+#include "VectorSet.h"
+
+using F = ModInt<998244353>;
+
+void testModIntArithmetic() {
+    F a(-1), b(3);
+    assert(a.value() == 998244352u);
+    assert((a + F(1)) == F(0));
+    assert((b / b) == F(1));
+    assert((b * b.inverse()).value() == 1u);
+    assert(F(2).pow(30).value() == (1u << 30) % F::modulus());
+    std::cout << "ModInt arithmetic test passed!" << std::endl;
+}
+
+void testFiniteFieldRank() {
+    // 有理数域上秩为 3，但 mod 5 时第三行 = 第一行 + 第二行
+    using F5 = ModInt<5>;
+    Matrix<long long> A(std::vector<std::vector<long long>>{{1, 2, 3}, {4, 0, 1}, {0, 7, 4}});
+    assert(A.rank() == 3);
+    Matrix<F5> A5 = A.cast<F5>();
+    assert(A5.rank() == 2);
+    assert(A5.determinant() == F5(0));
+
+    RREF<F5> r(A5);
+    for (const auto& v : r.getKernel()) {
+        Vector<F5> y = A5 * v;
+        for (size_t i = 0; i < y.size(); i++) assert(y[i] == F5(0));
+    }
+
+    Matrix<F> P = A.cast<F>();
+    assert(P.rank() == 3);
+    assert(P.determinant() == F(A.determinant()));
+    std::cout << "Finite-field rank test passed!" << std::endl;
+}
+
+void testFiniteFieldSolve() {
+    Matrix<F> A(std::vector<std::vector<F>>{{F(2), F(1), F(1)}, {F(1), F(3), F(2)}, {F(1), F(0), F(0)}});
+    Matrix<F> b(std::vector<std::vector<F>>{{F(4)}, {F(5)}, {F(6)}});
+    SolvingEquation<F> eq(A, b);
+    assert(eq.getSolutionType() == SolvingEquation<F>::SolutionType::UniqueSolution);
+    eq.computeSolution();
+    Vector<F> x = eq.getParticularSolution();
+    Vector<F> y = A * x;
+    for (size_t i = 0; i < 3; i++) assert(y[i] == b.at(i, 0));
+
+    Matrix<F> inv = A.getInverseMatrix();
+    Matrix<F> I = A * inv;
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 3; j++) assert(I.at(i, j) == F(i == j ? 1 : 0));
+
+    VectorSet<F> vs(std::vector<Vector<F>>{Vector<F>({F(1), F(2)}), Vector<F>({F(2), F(4)})});
+    assert(!vs.isLinearIndependent());
+    std::cout << "Finite-field solve test passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testModIntArithmetic();
+        testFiniteFieldRank();
+        testFiniteFieldSolve();
+    } catch(const std::exception& e) {
+        std::cerr << "Test failed with error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <atomic>
+#include <stdexcept>
+#include "Parallel.h"
+#include "RREF.h"
+
+// 线程数只决定切块方式：单核机器上同样走线程池
+static const size_t concurrencies[] = {1, 2, 3, 5, 8};
+
+void testParallelForCoverage() {
+    for (size_t c : concurrencies) {
+        setParallelConcurrency(c);
+        std::vector<std::atomic<int>> hits(1000);
+        parallelFor(0, hits.size(), 10, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; i++) hits[i]++;
+        });
+        for (const auto& h : hits) assert(h.load() == 1);
+
+        // 块内再次调用 parallelFor：调用线程自己领取内层的块，不会死锁
+        std::atomic<size_t> inner{0};
+        parallelFor(0, 16, 1, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; i++)
+                parallelFor(0, 100, 1, [&](size_t a, size_t b) { inner += b - a; });
+        });
+        assert(inner.load() == 1600);
+    }
+    setParallelConcurrency(0);
+    std::cout << "parallelFor coverage test passed!" << std::endl;
+}
+
+void testParallelForException() {
+    setParallelConcurrency(4);
+    bool threw = false;
+    try {
+        parallelFor(0, 1000, 1, [&](size_t lo, size_t hi) {
+            if (lo <= 900 && 900 < hi) throw std::overflow_error("chunk containing 900");
+        });
+    } catch (const std::overflow_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // 线程池在异常之后仍可用
+    std::atomic<size_t> count{0};
+    parallelFor(0, 1000, 1, [&](size_t lo, size_t hi) { count += hi - lo; });
+    assert(count.load() == 1000);
+
+    // Bareiss 的溢出发生在工作线程的行块里，照样到达调用方
+    Matrix<long long> A(400, 200);
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<long long> dist(-1000000, 1000000);
+    for (size_t i = 0; i < 400; i++)
+        for (size_t j = 0; j < 200; j++) A.at(i, j) = dist(gen);
+    threw = false;
+    try {
+        RREF<long long> r(A);
+        r.toREF();
+    } catch (const std::overflow_error&) {
+        threw = true;
+    }
+    assert(threw);
+    setParallelConcurrency(0);
+    std::cout << "parallelFor exception test passed!" << std::endl;
+}
+
+// 各行块互不依赖、日志在并行之前按行序写入：结果与日志逐位相同，与切块无关
+void testDeterministicChunking() {
+    const size_t n = 300;
+    Matrix<double> A(n, n + 7);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < n + 7; j++) A.at(i, j) = std::sin(double(i * (n + 7) + j)) + (i == j ? 2.0 : 0.0);
+
+    setParallelConcurrency(1);
+    RREF<double> ref(A);
+    ref.recordOperations();
+    ref.toRREF();
+
+    for (size_t c : concurrencies) {
+        setParallelConcurrency(c);
+        RREF<double> r(A);
+        r.recordOperations();
+        r.toRREF();
+        assert(r.getPivotCols() == ref.getPivotCols());
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n + 7; j++) assert(r.getMatrix().at(i, j) == ref.getMatrix().at(i, j));
+
+        const auto& ops = r.getOperations();
+        const auto& expected = ref.getOperations();
+        assert(ops.size() == expected.size());
+        for (size_t k = 0; k < ops.size(); k++) {
+            assert(ops[k].kind == expected[k].kind);
+            assert(ops[k].target == expected[k].target && ops[k].source == expected[k].source);
+            assert(ops[k].factor == expected[k].factor);
+        }
+    }
+    setParallelConcurrency(0);
+    std::cout << "Deterministic chunking test passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testParallelForCoverage();
+        testParallelForException();
+        testDeterministicChunking();
+    } catch(const std::exception& e) {
+        std::cerr << "Test failed with error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,64 @@
+#include <iostream>
+#include <cassert>
+#include "Rational.h"
+#include "matrix.h"
+#include "RREF.h"
+#include "SolvingEquation.h"
+
+using Q = Rational<BigInt>;
+
+void testBigIntPromotion() {
+    // 2^62 * 4 溢出 int64，应自动提升后再除回来
+    BigInt a(1LL << 62);
+    BigInt b = a * BigInt(4);
+    assert(!b.fitsInt64());
+    assert(b.toString() == "18446744073709551616");
+    assert(b / BigInt(4) == a);
+    assert((b / BigInt(4)).fitsInt64());
+    std::cout << "BigInt promotion test passed!" << std::endl;
+}
+
+void testExactHilbertInverse() {
+    // Hilbert 矩阵在 double 下严重病态，有理数下逆矩阵必须精确
+    const int n = 6;
+    Matrix<Q> H(n, n);
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            H.at(i, j) = Q(BigInt(1), BigInt(i + j + 1));
+
+    Matrix<Q> P = H * H.getInverseMatrix();
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            assert(P.at(i, j) == Q(i == j ? 1 : 0));
+    assert(H.rank() == n);
+    std::cout << "Exact Hilbert inverse test passed!" << std::endl;
+}
+
+void testExactSolutionType() {
+    // 秩 2 的系数矩阵：b 在列空间内为无穷多解，否则无解，不受容差影响
+    Matrix<Q> A(std::vector<std::vector<Q>>{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+    Matrix<Q> b1(std::vector<std::vector<Q>>{{1}, {2}, {3}});
+    Matrix<Q> b2(std::vector<std::vector<Q>>{{1}, {2}, {4}});
+
+    SolvingEquation<Q> s1(A, b1);
+    assert(s1.getSolutionType() == SolvingEquation<Q>::SolutionType::InfiniteSolutions);
+    s1.computeSolution();
+    Vector<Q> r = A * s1.getParticularSolution() - b1.getCol(0);
+    for (size_t i = 0; i < r.size(); i++) assert(r[i] == Q(0));
+
+    SolvingEquation<Q> s2(A, b2);
+    assert(s2.getSolutionType() == SolvingEquation<Q>::SolutionType::NoSolution);
+    std::cout << "Exact solution type test passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testBigIntPromotion();
+        testExactHilbertInverse();
+        testExactSolutionType();
+    } catch(const std::exception& e) {
+        std::cerr << "Test failed with error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,313 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <random>
+#include "RREF.h"
+#include "Rational.h"
+
+using Q = Rational<BigInt>;
+
+template <typename T>
+static Matrix<T> appendRowTo(const Matrix<T>& m, const Vector<T>& row) {
+    std::vector<std::vector<T>> d;
+    for (size_t i = 0; i < m.getRows(); i++) d.push_back(m.getRow(i).raw());
+    d.push_back(row.raw());
+    return Matrix<T>(d);
+}
+
+template <typename T, typename P1, typename P2>
+static bool sameReduction(const RREF<T, P1>& a, const RREF<T, P2>& b, double tol) {
+    if (a.getRank() != b.getRank() || a.getPivotCols() != b.getPivotCols()) return false;
+    const Matrix<T>& x = a.getMatrix();
+    const Matrix<T>& y = b.getMatrix();
+    for (size_t i = 0; i < x.getRows(); i++)
+        for (size_t j = 0; j < x.getCols(); j++)
+            if (std::abs(static_cast<double>(x.at(i, j) - y.at(i, j))) > tol) return false;
+    return true;
+}
+
+void testIncrementalRREF() {
+    // 秩 2：第三行 = 第一行 + 第二行
+    Matrix<double> A(std::vector<std::vector<double>>{{1, 2, 0, 1}, {0, 1, 1, 3}, {1, 3, 1, 4}});
+    RREF<double> inc(A);
+    inc.recordOperations();
+    inc.toRREF();
+    assert(inc.getRank() == 2);
+
+    Matrix<double> full = A;
+    // 相关行：秩不变；无关行：成为新主元行并插入到正确位置
+    const std::vector<std::vector<double>> rows = {{2, 5, 1, 5}, {0, 0, 2, 1}};
+    for (const auto& r : rows) {
+        Vector<double> v(r);
+        inc.appendRow(v);
+        full = appendRowTo(full, v);
+        RREF<double> ref(full);
+        ref.toRREF();
+        assert(sameReduction(inc, ref, 1e-12));
+    }
+    assert(inc.getRank() == 3);
+
+    // 相关列 (保持行之间的线性关系) 与无关列 (打破第三行 = 第一行 + 第二行)
+    const std::vector<std::vector<double>> cols = {{1, 1, 2, 3, 0}, {0, 0, 1, 0, 0}};
+    for (const auto& c : cols) {
+        Vector<double> v(c);
+        inc.appendColumn(v);
+        full = full.augment(Matrix<double>(v));
+        RREF<double> ref(full);
+        ref.toRREF();
+        assert(sameReduction(inc, ref, 1e-12));
+    }
+    assert(inc.getRank() == 4);
+    assert(inc.getKernel().size() == full.getCols() - 4);
+
+    // 有理数下结果精确
+    Matrix<Q> B(std::vector<std::vector<Q>>{{Q(1), Q(2), Q(3)}, {Q(2), Q(4), Q(6)}});
+    RREF<Q> exact(B);
+    exact.recordOperations();
+    exact.toRREF();
+    exact.appendRow(Vector<Q>(std::vector<Q>{Q(0), Q(1), Q(1, 3)}));
+    exact.appendColumn(Vector<Q>(std::vector<Q>{Q(1), Q(3), Q(5)}));
+    assert(exact.getRank() == 3);
+    assert(exact.getMatrix().at(0, 2) == Q(7, 3) && exact.getMatrix().at(1, 2) == Q(1, 3));
+
+    // 未开启日志时不能在已化简的矩阵上追加列
+    RREF<double> plain(A);
+    plain.toRREF();
+    bool threw = false;
+    try {
+        plain.appendColumn(Vector<double>(3, 1.0));
+    } catch (const std::logic_error&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "Incremental RREF test passed!" << std::endl;
+}
+
+void testBlockedREF() {
+    // 70 x 20 与 20 x 80 整数矩阵之积，秩恰为 20；规模超过阈值，走分块延迟更新路径
+    const size_t m = 70, n = 80, r = 20;
+    Matrix<long long> L(m, r), R(r, n);
+    std::mt19937 gen(9);
+    std::uniform_int_distribution<long long> dist(-3, 3);
+    auto rnd = [&]() { return dist(gen); };
+    for (size_t i = 0; i < m; i++)
+        for (size_t k = 0; k < r; k++) L.at(i, k) = rnd();
+    for (size_t k = 0; k < r; k++)
+        for (size_t j = 0; j < n; j++) R.at(k, j) = rnd();
+    Matrix<long long> P = L * R;
+    Matrix<double> A = P.cast<double>();
+
+    RREF<double> solver(A);
+    solver.toREF();
+    assert(solver.getRank() == r);
+    for (size_t i = 0; i < m; i++)
+        for (size_t j = 0; j < n; j++)
+            if (i >= r || j < solver.getPivotCols()[i]) assert(std::abs(solver.getMatrix().at(i, j)) < 1e-9);
+    for (const auto& v : solver.getKernel()) assert((A * v).norm() < 1e-8 * v.norm());
+
+    // 精确类型：与逐列消元的结果完全相同
+    Matrix<Q> exact = P.cast<Q>();
+    RREF<Q> q(exact);
+    q.toRREF();
+    assert(q.getRank() == r && q.getPivotCols() == solver.getPivotCols());
+    std::cout << "Blocked REF test passed!" << std::endl;
+}
+
+template <typename P>
+static double wilkinsonError(size_t n) {
+    // Wilkinson 增长矩阵：对角线与末列为 1，严格下三角为 -1；部分主元下末列增长 2^(n-1)
+    Matrix<double> aug(n, n + 1);
+    std::vector<double> x(n);
+    for (size_t i = 0; i < n; i++) x[i] = std::sin(static_cast<double>(i + 1));
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) aug.at(i, j) = (i == j || j == n - 1) ? 1.0 : (j < i ? -1.0 : 0.0);
+        for (size_t j = 0; j < n; j++) aug.at(i, n) += aug.at(i, j) * x[j];
+    }
+    RREF<double, P> r(aug);
+    r.toRREF();
+    assert(r.getRank() == n);
+    double err = 0;
+    for (size_t i = 0; i < n; i++) err = std::max(err, std::abs(r.getMatrix().at(i, n) - x[i]));
+    return err;
+}
+
+// 满秩方阵的所选主元列即字典序最前的一组：toRREF 只做一遍 Gauss-Jordan (每行一次缩放) 再换行
+template <typename P>
+static void fullRankColumnPivoting(const Matrix<double>& A) {
+    using Kind = typename RREF<double, P>::RowOperation::Kind;
+    const size_t n = A.getRows();
+    RREF<double, P> r(A);
+    r.recordOperations();
+    r.toREF();
+    const auto& pc = r.getPivotCols();
+    assert(r.getRank() == n && std::is_sorted(pc.begin(), pc.end()));
+    const size_t before = r.getOperations().size();
+    r.toRREF();
+    size_t scales = 0;
+    for (size_t k = before; k < r.getOperations().size(); k++)
+        if (r.getOperations()[k].kind == Kind::Scale) scales++;
+    assert(scales == n);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < n; j++) assert(std::abs(r.getMatrix().at(i, j) - (i == j ? 1.0 : 0.0)) < 1e-12);
+}
+
+void testPivotingPolicies() {
+    assert(wilkinsonError<PartialPivoting>(60) > 1e-3);
+    assert(wilkinsonError<ScaledPartialPivoting>(60) < 1e-6);
+    assert(wilkinsonError<RookPivoting>(60) < 1e-12);
+    assert(wilkinsonError<CompletePivoting>(60) < 1e-12);
+
+    // 秩亏矩阵：所有策略给出同一个最简形 (列主元策略最后按列序规范化)
+    Matrix<double> A(std::vector<std::vector<double>>{
+        {0, 1, 2, 3, 1}, {0, 2, 4, 7, 0}, {1e-3, 1, 2, 4, 5}, {0, 3, 6, 10, 1}});
+    RREF<double> partial(A);
+    partial.toRREF();
+    RREF<double, ScaledPartialPivoting> scaled(A);
+    scaled.toRREF();
+    RREF<double, RookPivoting> rook(A);
+    rook.toRREF();
+    RREF<double, CompletePivoting> complete(A);
+    complete.recordOperations();
+    complete.toRREF();
+    assert(partial.getRank() == 3);
+    assert(sameReduction(partial, scaled, 1e-9));
+    assert(sameReduction(partial, rook, 1e-9));
+    assert(sameReduction(partial, complete, 1e-9));
+    for (const auto& v : complete.getKernel()) assert((A * v).norm() < 1e-9);
+
+    // 日志包含规范化那一遍：追加的列经重放后与整体重算一致
+    Vector<double> extra(std::vector<double>{1, 0, 0, 2});
+    complete.appendColumn(extra);
+    RREF<double> whole(A.augment(extra));
+    whole.toRREF();
+    assert(sameReduction(whole, complete, 1e-9));
+
+    // toREF 只给出列置换意义下的阶梯形，主元列按列号升序；满秩方阵 toRREF 不再重新消元
+    Matrix<double> W(std::vector<std::vector<double>>{
+        {1e-6, 3, 0, 1, 2}, {2e6, 1, 5, 0, 1}, {0, 4e3, 1, 2, 0}, {1, 0, 2e-4, 7, 1}, {3, 1, 0, 1, 9e2}});
+    fullRankColumnPivoting<RookPivoting>(W);
+    fullRankColumnPivoting<CompletePivoting>(W);
+
+    // 精确类型：与部分主元逐元素相同
+    Matrix<Q> B(std::vector<std::vector<Q>>{
+        {Q(2), Q(4), Q(1), Q(3)}, {Q(1), Q(2), Q(5), Q(0)}, {Q(3), Q(6), Q(6), Q(3)}});
+    RREF<Q> exactPartial(B);
+    exactPartial.toRREF();
+    RREF<Q, RookPivoting> exactRook(B);
+    exactRook.toRREF();
+    assert(exactRook.getPivotCols() == exactPartial.getPivotCols());
+    for (size_t i = 0; i < B.getRows(); i++)
+        for (size_t j = 0; j < B.getCols(); j++)
+            assert(exactRook.getMatrix().at(i, j) == exactPartial.getMatrix().at(i, j));
+    std::cout << "Pivoting policy test passed!" << std::endl;
+}
+
+// 只做 toREF 就追加：append 内部的 toRREF 必须在新数据进入矩阵之前完成
+// 否则选列主元策略会把新行 / 新列一并消元两次 (重复主元列、NaN)
+template <typename P>
+static void appendAfterREF(unsigned seed) {
+    std::mt19937 gen(seed);
+    auto entry = [&gen] { return gen() % 3 == 0 ? 0.0 : static_cast<double>(static_cast<int>(gen() % 7) - 3); };
+    const size_t m = 2 + gen() % 4, n = 2 + gen() % 4;
+    std::vector<std::vector<double>> rows(m, std::vector<double>(n));
+    for (auto& r : rows)
+        for (auto& x : r) x = entry();
+    const Matrix<double> A(rows);
+
+    std::vector<double> row(n), col(m);
+    for (auto& x : row) x = entry();
+    for (auto& x : col) x = entry();
+
+    RREF<double, P> byRow(A);
+    byRow.toREF();
+    byRow.appendRow(Vector<double>(row));
+    RREF<double> wholeRow(appendRowTo(A, Vector<double>(row)));
+    wholeRow.toRREF();
+    assert(sameReduction(wholeRow, byRow, 1e-9));
+
+    RREF<double, P> byCol(A);
+    byCol.recordOperations();
+    byCol.toREF();
+    byCol.appendColumn(Vector<double>(col));
+    RREF<double> wholeCol(A.augment(Vector<double>(col)));
+    wholeCol.toRREF();
+    assert(sameReduction(wholeCol, byCol, 1e-9));
+}
+
+void testAppendAfterREF() {
+    for (unsigned seed = 0; seed < 200; seed++) {
+        appendAfterREF<PartialPivoting>(seed);
+        appendAfterREF<ScaledPartialPivoting>(seed);
+        appendAfterREF<RookPivoting>(seed);
+        appendAfterREF<CompletePivoting>(seed);
+    }
+    std::cout << "Append after REF test passed!" << std::endl;
+}
+
+template <typename T>
+static double maxDiff(const Matrix<T>& x, const Matrix<T>& y) {
+    double d = 0;
+    for (size_t i = 0; i < x.getRows(); i++)
+        for (size_t j = 0; j < x.getCols(); j++) d = std::max(d, std::abs(static_cast<double>(x.at(i, j) - y.at(i, j))));
+    return d;
+}
+
+void testTransformRecording() {
+    // 规模超过分块阈值：延迟更新路径的日志同样给出 E A = R
+    const size_t m = 90, n = 70;
+    Matrix<double> A(m, n);
+    std::mt19937 gen(21);
+    std::uniform_int_distribution<int> dist(-9, 9);
+    for (size_t i = 0; i < m; i++)
+        for (size_t j = 0; j < n; j++) A.at(i, j) = static_cast<double>(dist(gen));
+    RREF<double> r(A);
+    r.recordOperations();
+    r.toRREF();
+    Matrix<double> E = r.getTransform();
+    assert(maxDiff(E * A, r.getMatrix()) < 1e-9);
+
+    // 日志重放到另一矩阵：右端项随之变换
+    Matrix<double> B = A;
+    r.applyOperations(B);
+    assert(maxDiff(B, r.getMatrix()) < 1e-9);
+
+    // 列主元策略 + 追加行：E 随行数增长
+    RREF<double, RookPivoting> rook(A);
+    rook.recordOperations();
+    rook.toRREF();
+    Vector<double> row(std::vector<double>(n, 1.0));
+    rook.appendRow(row);
+    Matrix<double> grown = appendRowTo(A, row);
+    assert(maxDiff(rook.getTransform() * grown, rook.getMatrix()) < 1e-9);
+
+    // 置换部分与精确类型
+    Matrix<Q> C(std::vector<std::vector<Q>>{{Q(0), Q(2), Q(1)}, {Q(3), Q(1), Q(0)}, {Q(0), Q(0), Q(4)}});
+    RREF<Q> exact(C);
+    exact.recordOperations();
+    exact.toRREF();
+    Matrix<Q> EC = exact.getTransform() * C;
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 3; j++) assert(EC.at(i, j) == exact.getMatrix().at(i, j));
+    assert((exact.getRowPermutation() == std::vector<size_t>{1, 0, 2}));
+
+    bool threw = false;
+    RREF<double> unrecorded(A);
+    unrecorded.toRREF();
+    try { unrecorded.getTransform(); } catch (const std::logic_error&) { threw = true; }
+    assert(threw);
+    std::cout << "Transform recording test passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testIncrementalRREF();
+        testBlockedREF();
+        testPivotingPolicies();
+        testTransformRecording();
+        testAppendAfterREF();
+    } catch(const std::exception& e) {
+        std::cerr << "Test failed with error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
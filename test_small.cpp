@@ -0,0 +1,94 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include "Rational.h"
+#include "SolvingEquation.h"
+
+// n <= 4 的闭式路径应与 LU 结果一致
+void testSmallDeterminantInverse() {
+    for (size_t n = 1; n <= 4; n++) {
+        Matrix<double> A(n, n);
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++) A.at(i, j) = std::cos(double(3 * i + 5 * j + n)) + (i == j ? 1.5 : 0.0);
+
+        auto lu = A.luDecomposition();
+        double det = lu.sign;
+        for (size_t i = 0; i < n; i++) det *= lu.LU.at(i, i);
+        assert(std::abs(A.determinant() - det) < 1e-12);
+
+        Matrix<double> I = A * A.getInverseMatrix();
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++) assert(std::abs(I.at(i, j) - (i == j ? 1.0 : 0.0)) < 1e-12);
+    }
+
+    // 0x0：行列式为空积 1，逆为空矩阵 (Subspaces 对空子空间返回 0x0 矩阵)
+    Matrix<double> empty;
+    assert(empty.determinant() == 1.0);
+    Matrix<double> emptyInv = empty.getInverseMatrix();
+    assert(emptyInv.getRows() == 0 && emptyInv.getCols() == 0);
+    assert(Matrix<Rational<>>().determinant() == Rational<>(1));
+    assert(Matrix<long long>().determinant() == 1);
+
+    // 整体缩小的良态矩阵不应被判为奇异
+    Matrix<double> scaled = Matrix<double>::identity(4) * 1e-3;
+    assert(std::abs(scaled.getInverseMatrix().at(2, 2) - 1000.0) < 1e-9);
+
+    bool threw = false;
+    try {
+        Matrix<double>(std::vector<std::vector<double>>{{1, 2}, {2, 4}}).getInverseMatrix();
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    Matrix<Rational<>> R(std::vector<std::vector<Rational<>>>{{Rational<>(2), Rational<>(1)}, {Rational<>(7), Rational<>(4)}});
+    Matrix<Rational<>> Rinv = R.getInverseMatrix();
+    assert(Rinv.at(0, 0) == Rational<>(4) && Rinv.at(1, 0) == Rational<>(-7));
+    std::cout << "Small determinant/inverse test passed!" << std::endl;
+}
+
+void testSmallSolve() {
+    using SE = SolvingEquation<double>;
+    Matrix<double> A(std::vector<std::vector<double>>{{4, 1, 2}, {1, 5, 3}, {2, 3, 6}});
+    Matrix<double> b(std::vector<std::vector<double>>{{7}, {9}, {11}});
+    SE eq(A, b);
+    assert(eq.getSolutionType() == SE::SolutionType::UniqueSolution);
+    eq.computeSolution();
+    Vector<double> r = A * eq.getParticularSolution();
+    for (size_t i = 0; i < 3; i++) assert(std::abs(r[i] - b.at(i, 0)) < 1e-12);
+
+    // 奇异方阵仍交给 RREF 判定
+    Matrix<double> S(std::vector<std::vector<double>>{{1, 2}, {2, 4}});
+    assert(SE(S, Matrix<double>(std::vector<std::vector<double>>{{1}, {2}})).getSolutionType() == SE::SolutionType::InfiniteSolutions);
+    assert(SE(S, Matrix<double>(std::vector<std::vector<double>>{{1}, {3}})).getSolutionType() == SE::SolutionType::NoSolution);
+    std::cout << "Small solve test passed!" << std::endl;
+}
+
+// 整数小矩阵同样走带溢出检查的 Bareiss：乘积超出 long long 时抛出而不是返回回绕后的值
+void testSmallIntegerOverflow() {
+    Matrix<long long> ok(std::vector<std::vector<long long>>{{3, 1}, {7, 5}});
+    assert(ok.determinant() == 8);
+
+    const long long big = 10000000000LL;
+    Matrix<long long> A(std::vector<std::vector<long long>>{{big, 3}, {7, big}});
+    bool threw = false;
+    try {
+        A.determinant();
+    } catch (const std::overflow_error&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "Small integer overflow test passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testSmallDeterminantInverse();
+        testSmallSolve();
+        testSmallIntegerOverflow();
+    } catch(const std::exception& e) {
+        std::cerr << "Test failed with error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
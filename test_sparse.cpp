@@ -0,0 +1,112 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <chrono>
+#include "SparseRREF.h"
+#include "RREF.h"
+#include "Rational.h"
+
+using Q = Rational<BigInt>;
+
+void testSmallSparse() {
+    // 秩 3：第四行 = 第一行 + 第三行；第 4 列全零
+    Matrix<double> A(std::vector<std::vector<double>>{
+        {2, 0, 0, 1, 0, 0}, {0, 0, 3, 0, 0, 1}, {0, 1, 0, 0, 0, 4}, {2, 1, 0, 1, 0, 4}});
+    SparseMatrix<double> S(A);
+    assert(S.nonZeros() == 10);
+    SparseRREF<double> sparse(S);
+    RREF<double> dense(A);
+    auto denseKernel = dense.getKernel();
+    assert(sparse.getRank() == dense.getRank());
+
+    SparseMatrix<double> K = sparse.getKernel();
+    assert(K.getRows() == 6 - 3);
+    for (size_t t = 0; t < K.getRows(); t++) assert((S * K.getRowVector(t)).norm() < 1e-12);
+    // 与 getKernel 同构：第 t 个基向量在第 t 个自由列上为 1、其余自由列上为 0；
+    // Markowitz 选出的主元列 {0, 2, 5} 与稠密 RREF 的 {0, 1, 2} 不同，两组基张成同一子空间
+    const auto& pc = sparse.getPivotCols();
+    std::vector<size_t> freeCols;
+    for (size_t j = 0; j < 6; j++)
+        if (std::find(pc.begin(), pc.end(), j) == pc.end()) freeCols.push_back(j);
+    for (size_t t = 0; t < K.getRows(); t++)
+        for (size_t u = 0; u < freeCols.size(); u++) assert(K.at(t, freeCols[u]) == (t == u ? 1.0 : 0.0));
+    Matrix<double> both(6, 6);
+    for (size_t t = 0; t < 3; t++)
+        for (size_t j = 0; j < 6; j++) {
+            both.at(t, j) = K.at(t, j);
+            both.at(t + 3, j) = denseKernel[t][j];
+        }
+    assert(both.rank() == 3);
+    std::cout << "Small sparse RREF test passed!" << std::endl;
+}
+
+void testExactSparse() {
+    Matrix<Q> A(std::vector<std::vector<Q>>{
+        {Q(1), Q(2), Q(0), Q(3)}, {Q(0), Q(1), Q(1), Q(0)}, {Q(1), Q(3), Q(1), Q(3)}});
+    SparseMatrix<Q> S(A);
+    SparseRREF<Q> r(S);
+    assert(r.getRank() == 2);
+    SparseMatrix<Q> K = r.getKernel();
+    assert(K.getRows() == 2);
+    for (size_t t = 0; t < K.getRows(); t++) {
+        Vector<Q> y = S * K.getRowVector(t);
+        for (size_t i = 0; i < y.size(); i++) assert(y[i] == Q(0));
+    }
+    std::cout << "Exact sparse RREF test passed!" << std::endl;
+}
+
+void testLargeSparse() {
+    // 二维网格上的差分约束：每行 x_i - x_j (相邻节点)，约 2n 行、n 列；连通图的秩为 n - 1，
+    // 零空间为常向量；再加 n / 10 个稀疏的随机三元约束 a x_i + b x_j - (a + b) x_k，
+    // 系数和为 0 不改变秩与零空间，但跨越网格的远距离耦合会在消元中产生填充
+    const size_t side = 150, n = side * side;
+    std::vector<std::pair<size_t, size_t>> edges;
+    for (size_t i = 0; i < side; i++)
+        for (size_t j = 0; j < side; j++) {
+            if (j + 1 < side) edges.push_back({i * side + j, i * side + j + 1});
+            if (i + 1 < side) edges.push_back({i * side + j, (i + 1) * side + j});
+        }
+    const size_t extra = n / 10;
+    SparseMatrix<double> A(edges.size() + extra, n);
+    for (size_t e = 0; e < edges.size(); e++) {
+        A.add(e, edges[e].first, 1.0);
+        A.add(e, edges[e].second, -1.0);
+    }
+    std::mt19937 gen(12345);
+    auto next = [&gen](size_t bound) { return static_cast<size_t>(gen() % bound); };
+    for (size_t t = 0; t < extra; t++) {
+        const size_t row = edges.size() + t;
+        size_t i = next(n), j = next(n), k = next(n);
+        while (j == i) j = next(n);
+        while (k == i || k == j) k = next(n);
+        const double a = 1.0 + double(next(4)), b = 0.5 + double(next(5)) * 0.5;
+        A.add(row, i, a);
+        A.add(row, j, b);
+        A.add(row, k, -(a + b));
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    SparseRREF<double> r(A);
+    assert(r.getRank() == n - 1);
+    SparseMatrix<double> K = r.getKernel();
+    auto t1 = std::chrono::steady_clock::now();
+    assert(K.getRows() == 1);
+    Vector<double> v = K.getRowVector(0);
+    for (size_t i = 0; i < n; i++) assert(std::abs(v[i] - 1.0) < 1e-9);
+    assert((A * v).norm() < 1e-9);
+    std::cout << "Large sparse RREF test passed! (" << n << " unknowns, "
+              << std::chrono::duration<double>(t1 - t0).count() << " s)" << std::endl;
+}
+
+int main() {
+    try {
+        testSmallSparse();
+        testExactSparse();
+        testLargeSparse();
+    } catch(const std::exception& e) {
+        std::cerr << "Test failed with error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
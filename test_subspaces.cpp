@@ -0,0 +1,100 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include "Subspaces.h"
+#include "Rational.h"
+
+using Q = Rational<BigInt>;
+
+static double maxAbs(const Matrix<double>& M) {
+    double d = 0;
+    for (size_t i = 0; i < M.getRows(); i++)
+        for (size_t j = 0; j < M.getCols(); j++) d = std::max(d, std::abs(M.at(i, j)));
+    return d;
+}
+
+void testFourSubspaces() {
+    // 4 x 5，秩 2：第三行 = 第一行 + 第二行，第四行 = 2 倍第一行
+    Matrix<double> A(std::vector<std::vector<double>>{
+        {1, 2, 0, 1, 3}, {0, 0, 1, 4, 1}, {1, 2, 1, 5, 4}, {2, 4, 0, 2, 6}});
+    Subspaces<double> S(A);
+    assert(S.getRank() == 2 && S.nullity() == 3);
+    assert((S.getPivotCols() == std::vector<size_t>{0, 2}));
+
+    // 维数：r + (n - r) = n，r + (m - r) = m
+    assert(S.columnSpace().getRows() == 4 && S.columnSpace().getCols() == 2);
+    assert(S.rowSpace().getRows() == 2 && S.rowSpace().getCols() == 5);
+    assert(S.nullSpace().getRows() == 5 && S.nullSpace().getCols() == 3);
+    assert(S.leftNullSpace().getRows() == 2 && S.leftNullSpace().getCols() == 4);
+
+    assert(maxAbs(A * S.nullSpace()) < 1e-12);
+    assert(maxAbs(S.leftNullSpace() * A) < 1e-12);
+    assert(S.columnSpace().rank() == 2 && S.leftNullSpace().rank() == 2);
+    // 行空间与零空间正交，列空间与左零空间正交
+    assert(maxAbs(S.rowSpace() * S.nullSpace()) < 1e-12);
+    assert(maxAbs(S.leftNullSpace() * S.columnSpace()) < 1e-12);
+
+    // 与 RREF::getKernel 给出同一组零空间基
+    RREF<double> r(A);
+    auto kernel = r.getKernel();
+    for (size_t f = 0; f < kernel.size(); f++)
+        for (size_t j = 0; j < 5; j++) assert(std::abs(kernel[f][j] - S.nullSpace().at(j, f)) < 1e-12);
+
+    // 满秩方阵：零空间与左零空间为空
+    Subspaces<double> full(Matrix<double>(std::vector<std::vector<double>>{{2, 1}, {1, 3}}));
+    assert(full.getRank() == 2 && full.nullSpace().getRows() == 0 && full.leftNullSpace().getRows() == 0);
+    std::cout << "Four subspaces test passed!" << std::endl;
+}
+
+// 高瘦矩阵：左零空间维数 m - r 远大于 n，由行变换日志直接给出 (不对 [A | I_m] 消元)
+template <typename P>
+void checkTallLeftNull() {
+    const size_t m = 60, n = 4;
+    Matrix<double> A(m, n);
+    for (size_t i = 0; i < m; i++) {
+        for (size_t j = 0; j + 1 < n; j++) A.at(i, j) = std::cos(double((i + 1) * (j + 1)));
+        A.at(i, n - 1) = A.at(i, 0) - 2 * A.at(i, 2);  // 秩 3
+    }
+    Subspaces<double, P> S(A);
+    assert(S.getRank() == 3);
+    assert(S.leftNullSpace().getRows() == m - 3 && S.leftNullSpace().getCols() == m);
+    assert(S.leftNullSpace().rank() == m - 3);
+    assert(maxAbs(S.leftNullSpace() * A) < 1e-10);
+}
+
+void testTallSubspaces() {
+    checkTallLeftNull<PartialPivoting>();
+    checkTallLeftNull<ScaledPartialPivoting>();
+    checkTallLeftNull<RookPivoting>();
+    checkTallLeftNull<CompletePivoting>();
+    std::cout << "Tall subspaces test passed!" << std::endl;
+}
+
+void testExactSubspaces() {
+    Matrix<long long> A(std::vector<std::vector<long long>>{{2, 4, 1}, {1, 2, 3}, {3, 6, 4}});
+    Subspaces<long long> S(A);
+    assert(S.getRank() == 2);
+    Matrix<long long> AN = A * S.nullSpace();
+    Matrix<long long> LA = S.leftNullSpace() * A;
+    for (size_t i = 0; i < 3; i++) assert(AN.at(i, 0) == 0 && LA.at(0, i) == 0);
+
+    Matrix<Q> B(std::vector<std::vector<Q>>{{Q(1), Q(3), Q(2)}, {Q(2), Q(6), Q(4)}});
+    Subspaces<Q, RookPivoting> T(B);
+    assert(T.getRank() == 1 && T.nullSpace().getCols() == 2 && T.leftNullSpace().getRows() == 1);
+    Matrix<Q> BN = B * T.nullSpace();
+    for (size_t i = 0; i < 2; i++)
+        for (size_t j = 0; j < 2; j++) assert(BN.at(i, j) == Q(0));
+    std::cout << "Exact subspaces test passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testFourSubspaces();
+        testExactSubspaces();
+        testTallSubspaces();
+    } catch(const std::exception& e) {
+        std::cerr << "Test failed with error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
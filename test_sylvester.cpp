@@ -0,0 +1,97 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <random>
+#include "Sylvester.h"
+
+static Matrix<double> randomMatrix(size_t r, size_t c, unsigned seed, double diag = 0) {
+    Matrix<double> M(r, c);
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-0.5, 0.5);
+    for (size_t i = 0; i < r; i++)
+        for (size_t j = 0; j < c; j++) M.at(i, j) = dist(gen) + (i == j ? diag : 0);
+    return M;
+}
+
+void testRealSchur() {
+    Matrix<double> A = randomMatrix(12, 12, 3);
+    auto schur = A.realSchur();
+    Matrix<double> I = Matrix<double>::identity(12);
+    assert((schur.Q * schur.S * schur.Q.transpose() - A).normFrobenius() < 1e-12);
+    assert((schur.Q.transpose() * schur.Q - I).normFrobenius() < 1e-12);
+    for (size_t i = 2; i < 12; i++)
+        for (size_t j = 0; j + 1 < i; j++) assert(schur.S.at(i, j) == 0.0);
+
+    // 旋转矩阵的特征值为共轭复数，保留 2x2 块；实特征值的 2x2 块被拆开
+    Matrix<double> R(std::vector<std::vector<double>>{{0, -1, 0}, {1, 0, 0}, {0, 0, 2}});
+    auto rs = R.realSchur();
+    assert(rs.blocks().size() == 3);  // {0, 2, 3}
+    Matrix<double> P(std::vector<std::vector<double>>{{1, 2}, {3, 4}});
+    auto ps = P.realSchur();
+    assert(ps.S.at(1, 0) == 0.0 && ps.blocks().size() == 3);
+    assert(std::abs(ps.S.at(0, 0) * ps.S.at(1, 1) + 2.0) < 1e-12);  // det = -2
+    std::cout << "Real Schur test passed!" << std::endl;
+}
+
+void testSylvester() {
+    Matrix<double> A = randomMatrix(20, 20, 11, 3.0);
+    Matrix<double> B = randomMatrix(15, 15, 17, 2.0);
+    SylvesterSolver<double> solver(A, B);
+    // 多个右端项复用同一对 Schur 因子
+    std::vector<Matrix<double>> rhs = {randomMatrix(20, 15, 5), randomMatrix(20, 15, 6)};
+    std::vector<Matrix<double>> xs = solver.solve(rhs);
+    for (size_t k = 0; k < rhs.size(); k++)
+        assert((A * xs[k] + xs[k] * B - rhs[k]).normFrobenius() < 1e-12 * rhs[k].normFrobenius());
+
+    // 稳定矩阵的 Lyapunov 方程：解对称
+    Matrix<double> S = randomMatrix(10, 10, 23, -3.0);
+    Matrix<double> Q = Matrix<double>::identity(10);
+    Matrix<double> X = solveLyapunov(S, Q);
+    assert((S * X + X * S.transpose() - Q).normFrobenius() < 1e-12);
+    assert((X - X.transpose()).normFrobenius() < 1e-12);
+
+    // A 与 -B 有公共特征值 1
+    Matrix<double> D1(std::vector<std::vector<double>>{{1, 0}, {0, 2}});
+    Matrix<double> D2(std::vector<std::vector<double>>{{-1, 0}, {0, 5}});
+    bool threw = false;
+    try {
+        solveSylvester(D1, D2, D1);
+    } catch (const std::domain_error&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "Sylvester / Lyapunov test passed!" << std::endl;
+}
+
+void testSylvesterScaled() {
+    // 特征值均为 1e-10 量级：可解性的判定随 A、B 的尺度缩放，不受绝对阈值影响
+    Matrix<double> A(std::vector<std::vector<double>>{{1e-10, 0}, {0, 2e-10}});
+    Matrix<double> B(std::vector<std::vector<double>>{{3e-10, 0}, {0, 5e-10}});
+    Matrix<double> C(std::vector<std::vector<double>>{{1e-10, 2e-10}, {3e-10, 4e-10}});
+    Matrix<double> X = solveSylvester(A, B, C);
+    assert((A * X + X * B - C).normFrobenius() < 1e-12 * C.normFrobenius());
+    assert(std::abs(X.at(0, 0) - 0.25) < 1e-12);
+
+    // 同一尺度下 A 与 -B 真有公共特征值时照样报告
+    Matrix<double> N(std::vector<std::vector<double>>{{-1e-10, 0}, {0, 7e-10}});
+    bool threw = false;
+    try {
+        solveSylvester(A, N, C);
+    } catch (const std::domain_error&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "Scaled Sylvester test passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testRealSchur();
+        testSylvester();
+        testSylvesterScaled();
+    } catch(const std::exception& e) {
+        std::cerr << "Test failed with error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
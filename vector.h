@@ -9,6 +9,7 @@
 #include<vector>
 #include<cmath>
 #include<stdexcept>
+#include "ScalarTraits.h"
 
 template<typename T>
 class Vector{
@@ -38,6 +39,15 @@ class Vector{
 
         const std::vector<T>& raw() const noexcept { return data; }
 
+        // 标量类型转换 (如 double -> float)
+        template <typename U>
+        Vector<U> cast() const {
+            std::vector<U> res_vec(size());
+            for (size_t i = 0; i < size(); i++)
+                res_vec[i] = static_cast<U>(data[i]);
+            return Vector<U>(std::move(res_vec));
+        }
+
         // 四则运算
         Vector<T> operator+(const Vector<T>& other) const {
             if (size() != other.size())
@@ -65,9 +75,12 @@ class Vector{
         }
 
         Vector<T> operator/(T scalar) const {
-            if (std::abs(scalar) < 1e-9)
+            if (ScalarTraits<T>::isZero(scalar, ScalarTraits<T>::epsilon()))
                 throw std::invalid_argument("Division by zero");
-            return (*this) * (1.0 / scalar);
+            std::vector<T> res_vec(size());
+            for (size_t i = 0; i < size(); i++)
+                res_vec[i] = data[i] / scalar;
+            return Vector<T>(res_vec);
         }
 
         Vector<T>& operator+=(const Vector<T>& other) {
@@ -92,7 +105,7 @@ class Vector{
         }
 
         Vector<T>& operator/=(T scalar) {
-            if (std::abs(scalar) < 1e-9)
+            if (ScalarTraits<T>::isZero(scalar, ScalarTraits<T>::epsilon()))
                 throw std::invalid_argument("Division by zero");
             for (auto& el : data) el /= scalar;
             return *this;
@@ -113,35 +126,35 @@ class Vector{
         }
 
         T norm() const {
-            return std::sqrt(this->dot(*this));
+            return ScalarTraits<T>::sqrt(this->dot(*this));
         }
 
         // 1-范数：元素绝对值之和
         T norm1() const {
             T sum = 0;
-            for (const auto& el : data) sum += std::abs(el);
+            for (const auto& el : data) sum += ScalarTraits<T>::abs(el);
             return sum;
         }
 
         // ∞-范数：元素绝对值的最大值
         T normInf() const {
             if (data.empty()) return 0;
-            T maxVal = std::abs(data[0]);
+            T maxVal = ScalarTraits<T>::abs(data[0]);
             for (size_t i = 1; i < data.size(); i++) {
-                maxVal = std::max(maxVal, std::abs(data[i]));
+                maxVal = std::max(maxVal, ScalarTraits<T>::abs(data[i]));
             }
             return maxVal;
         }
 
-        Vector<T> normalized(T eps = 1e-9) const {
+        Vector<T> normalized(T eps = ScalarTraits<T>::epsilon()) const {
             T n = norm();
-            if (n < eps)
+            if (ScalarTraits<T>::isZero(n, eps))
                 throw std::invalid_argument("Cannot normalize zero vector");
             return (*this) * (1 / n);
         }
 
-        bool isOrthogonalTo(const Vector<T>& other, T eps = 1e-9) const {
-            return std::fabs(dot(other)) < eps;
+        bool isOrthogonalTo(const Vector<T>& other, T eps = ScalarTraits<T>::epsilon()) const {
+            return ScalarTraits<T>::isZero(dot(other), eps);
         }
 
         void print() const {